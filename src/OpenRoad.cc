@@ -64,6 +64,7 @@
 #include "mpl2/MakeMacroPlacer.h"
 #include "odb/cdl.h"
 #include "odb/db.h"
+#include "odb/dbMappedFile.h"
 #include "odb/defin.h"
 #include "odb/defout.h"
 #include "odb/lefin.h"
@@ -451,10 +452,19 @@ void OpenRoad::readDb(const char* filename)
         ORD, 47, "You can't load a new db file as the db is already populated");
   }
 
-  std::ifstream stream;
+  // Prefer reading straight out of a memory mapping; fall back to a regular
+  // file stream if the file can't be mapped (e.g. a pipe).
+  odb::dbMappedFileBuf mapped(filename);
+  std::ifstream file;
+  std::istream stream(nullptr);
+  if (mapped.isOpen()) {
+    stream.rdbuf(&mapped);
+  } else {
+    file.open(filename, std::ios::binary);
+    stream.rdbuf(file.rdbuf());
+  }
   stream.exceptions(std::ifstream::failbit | std::ifstream::badbit
                     | std::ios::eofbit);
-  stream.open(filename, std::ios::binary);
 
   try {
     db_->read(stream);
@@ -474,7 +484,7 @@ void OpenRoad::writeDb(const char* filename)
                     | std::ios::eofbit);
   stream.open(filename, std::ios::binary);
 
-  db_->write(stream);
+  db_->write(stream, threads_);
 }
 
 void OpenRoad::diffDbs(const char* filename1,
@@ -60,6 +60,7 @@ using utl::Logger;
 struct PARinfo;
 struct ARinfo;
 struct AntennaModel;
+struct NetCheckInfo;
 
 class GlobalRouteSource
 {
@@ -89,7 +90,9 @@ class AntennaChecker
             utl::Logger* logger);
 
   // net nullptr -> check all nets
-  int checkAntennas(dbNet* net = nullptr, bool verbose = false);
+  int checkAntennas(dbNet* net = nullptr,
+                    bool verbose = false,
+                    int num_threads = 1);
   int antennaViolationCount() const;
 
   void findMaxWireLength();
@@ -182,6 +185,24 @@ class AntennaChecker
                 int& net_violation_count,
                 int& pin_violation_count,
                 bool use_grt_routes);
+  void checkNets(const vector<dbNet*>& nets,
+                 bool verbose,
+                 std::ofstream& report_file,
+                 // Return values.
+                 int& net_violation_count,
+                 int& pin_violation_count,
+                 bool use_grt_routes,
+                 int num_threads);
+  void prepareNet(NetCheckInfo& info, bool use_grt_routes);
+  void evaluateNet(NetCheckInfo& info);
+  void reportNet(NetCheckInfo& info,
+                 bool report_if_no_violation,
+                 bool verbose,
+                 std::ofstream& report_file,
+                 // Return values.
+                 int& net_violation_count,
+                 int& pin_violation_count);
+  void restoreNet(NetCheckInfo& info, bool use_grt_routes);
   void checkGate(dbWireGraph::Node* gate,
                  vector<ARinfo>& CARtable,
                  vector<ARinfo>& VIA_CARtable,
@@ -33,6 +33,7 @@
 
 #include <tcl.h>
 
+#include <algorithm>
 #include <cstdio>
 #include <cstring>
 #include <fstream>
@@ -107,6 +108,19 @@ struct ARinfo
   double diff_CSR;
 };
 
+// Per-net result of the (thread safe) evaluation pass of checkAntennas.
+struct NetCheckInfo
+{
+  dbNet* net = nullptr;
+  std::vector<int> data;
+  std::vector<unsigned char> op_code;
+  vector<dbWireGraph::Node*> gate_nodes;
+  vector<ARinfo> CARtable;
+  vector<ARinfo> VIA_CARtable;
+  bool violation = false;
+  int pin_violation_count = 0;
+};
+
 struct AntennaModel
 {
   odb::dbTechLayer* layer;
@@ -1568,68 +1582,140 @@ void AntennaChecker::checkNet(dbNet* net,
 {
   dbWire* wire = net->getWire();
   if (wire) {
-    std::vector<int> data;
-    std::vector<unsigned char> op_code;
-    if (!use_grt_routes) {
-      wire->getRawWireData(data, op_code);
-      odb::orderWires(logger_, net);
+    NetCheckInfo info;
+    info.net = net;
+    prepareNet(info, use_grt_routes);
+    evaluateNet(info);
+    reportNet(info,
+              report_if_no_violation,
+              verbose,
+              report_file,
+              net_violation_count,
+              pin_violation_count);
+    restoreNet(info, use_grt_routes);
+  }
+}
+
+void AntennaChecker::checkNets(const vector<dbNet*>& nets,
+                               bool verbose,
+                               std::ofstream& report_file,
+                               // Return values.
+                               int& net_violation_count,
+                               int& pin_violation_count,
+                               bool use_grt_routes,
+                               int num_threads)
+{
+  // Wire ordering edits the db and goes through a shared tmg_conn, and
+  // reporting must come out in net order, so only the table building and
+  // ratio checks run in parallel. Nets are processed in batches to bound
+  // the memory held by the saved wire data and tables.
+  const int batch_size = std::max(1, num_threads) * 64;
+  vector<NetCheckInfo> infos;
+  for (size_t begin = 0; begin < nets.size(); begin += batch_size) {
+    const size_t end = std::min(nets.size(), begin + batch_size);
+    infos.clear();
+    infos.resize(end - begin);
+    for (size_t i = begin; i < end; i++) {
+      infos[i - begin].net = nets[i];
+      prepareNet(infos[i - begin], use_grt_routes);
     }
-    vector<dbWireGraph::Node*> wire_roots;
-    vector<dbWireGraph::Node*> gate_nodes;
-    findWireRoots(wire, wire_roots, gate_nodes);
 
-    vector<PARinfo> PARtable = buildWireParTable(wire_roots);
-    vector<PARinfo> VIA_PARtable = buildViaParTable(wire_roots);
-    vector<ARinfo> CARtable
-        = buildWireCarTable(PARtable, VIA_PARtable, gate_nodes);
-    vector<ARinfo> VIA_CARtable
-        = buildViaCarTable(PARtable, VIA_PARtable, gate_nodes);
+#pragma omp parallel for num_threads(num_threads) schedule(dynamic)
+    for (int i = 0; i < static_cast<int>(infos.size()); i++) {
+      evaluateNet(infos[i]);
+    }
 
-    bool violation = false;
-    unordered_set<dbWireGraph::Node*> violated_gates;
-    for (dbWireGraph::Node* gate : gate_nodes) {
-      checkGate(gate,
-                CARtable,
-                VIA_CARtable,
+    for (NetCheckInfo& info : infos) {
+      reportNet(info,
                 false,
                 verbose,
                 report_file,
-                violation,
-                violated_gates);
+                net_violation_count,
+                pin_violation_count);
+      restoreNet(info, use_grt_routes);
     }
+  }
+}
 
-    if (violation) {
-      net_violation_count++;
-      pin_violation_count += violated_gates.size();
-    }
+void AntennaChecker::prepareNet(NetCheckInfo& info, bool use_grt_routes)
+{
+  if (!use_grt_routes) {
+    info.net->getWire()->getRawWireData(info.data, info.op_code);
+    odb::orderWires(logger_, info.net);
+  }
+}
 
-    // Repeat with reporting.
-    if (violation || report_if_no_violation) {
-      std::string net_name = fmt::format("Net: {}", net->getConstName());
+void AntennaChecker::restoreNet(NetCheckInfo& info, bool use_grt_routes)
+{
+  if (!use_grt_routes) {
+    info.net->getWire()->setRawWireData(info.data, info.op_code);
+  }
+}
 
-      if (report_file.is_open()) {
-        report_file << net_name << "\n";
-      }
-      if (verbose) {
-        logger_->report("{}", net_name);
-      }
+void AntennaChecker::evaluateNet(NetCheckInfo& info)
+{
+  vector<dbWireGraph::Node*> wire_roots;
+  findWireRoots(info.net->getWire(), wire_roots, info.gate_nodes);
+
+  vector<PARinfo> PARtable = buildWireParTable(wire_roots);
+  vector<PARinfo> VIA_PARtable = buildViaParTable(wire_roots);
+  info.CARtable = buildWireCarTable(PARtable, VIA_PARtable, info.gate_nodes);
+  info.VIA_CARtable
+      = buildViaCarTable(PARtable, VIA_PARtable, info.gate_nodes);
+
+  std::ofstream no_report;
+  unordered_set<dbWireGraph::Node*> violated_gates;
+  for (dbWireGraph::Node* gate : info.gate_nodes) {
+    checkGate(gate,
+              info.CARtable,
+              info.VIA_CARtable,
+              false,
+              false,
+              no_report,
+              info.violation,
+              violated_gates);
+  }
+  info.pin_violation_count = violated_gates.size();
+}
 
-      for (dbWireGraph::Node* gate : gate_nodes) {
-        checkGate(gate,
-                  CARtable,
-                  VIA_CARtable,
-                  true,
-                  verbose,
-                  report_file,
-                  violation,
-                  violated_gates);
-      }
-      if (verbose) {
-        logger_->report("");
-      }
+void AntennaChecker::reportNet(NetCheckInfo& info,
+                               bool report_if_no_violation,
+                               bool verbose,
+                               std::ofstream& report_file,
+                               // Return values.
+                               int& net_violation_count,
+                               int& pin_violation_count)
+{
+  if (info.violation) {
+    net_violation_count++;
+    pin_violation_count += info.pin_violation_count;
+  }
+
+  // Repeat with reporting.
+  if (info.violation || report_if_no_violation) {
+    std::string net_name = fmt::format("Net: {}", info.net->getConstName());
+
+    if (report_file.is_open()) {
+      report_file << net_name << "\n";
     }
-    if (!use_grt_routes) {
-      wire->setRawWireData(data, op_code);
+    if (verbose) {
+      logger_->report("{}", net_name);
+    }
+
+    bool violation = info.violation;
+    unordered_set<dbWireGraph::Node*> violated_gates;
+    for (dbWireGraph::Node* gate : info.gate_nodes) {
+      checkGate(gate,
+                info.CARtable,
+                info.VIA_CARtable,
+                true,
+                verbose,
+                report_file,
+                violation,
+                violated_gates);
+    }
+    if (verbose) {
+      logger_->report("");
     }
   }
 }
@@ -1741,7 +1827,7 @@ void AntennaChecker::checkGate(
   }
 }
 
-int AntennaChecker::checkAntennas(dbNet* net, bool verbose)
+int AntennaChecker::checkAntennas(dbNet* net, bool verbose, int num_threads)
 {
   initAntennaRules();
 
@@ -1781,17 +1867,19 @@ int AntennaChecker::checkAntennas(dbNet* net, bool verbose)
           ANT, 14, "Skipped net {} because it is special.", net->getName());
     }
   } else {
+    vector<dbNet*> nets;
     for (dbNet* net : block_->getNets()) {
-      if (!net->isSpecial()) {
-        checkNet(net,
-                 false,
-                 verbose,
-                 report_file,
-                 net_violation_count,
-                 pin_violation_count,
-                 use_grt_routes);
+      if (!net->isSpecial() && net->getWire()) {
+        nets.push_back(net);
       }
     }
+    checkNets(nets,
+              verbose,
+              report_file,
+              net_violation_count,
+              pin_violation_count,
+              use_grt_routes,
+              num_threads);
   }
 
   logger_->info(ANT, 2, "Found {} net violations.", net_violation_count);
@@ -66,7 +66,8 @@ check_antennas(const char *net_name, bool verbose)
       logger->error(utl::ANT, 12, "Net {} not found.", net_name);
     }
   }
-  return getAntennaChecker()->checkAntennas(net, verbose);
+  return getAntennaChecker()->checkAntennas(
+      net, verbose, app->getThreadCount());
 }
 
 int
@@ -108,6 +108,8 @@ class CtsOptions
   {
     return charWirelengthIterations_;
   }
+  void setCharCacheDir(const std::string& dir) { charCacheDir_ = dir; }
+  const std::string& getCharCacheDir() const { return charCacheDir_; }
   void setCapSteps(int steps) { capSteps_ = steps; }
   int getCapSteps() const { return capSteps_; }
   void setSlewSteps(int steps) { slewSteps_ = steps; }
@@ -269,6 +271,7 @@ class CtsOptions
   unsigned maxSlew_ = 4;
   double maxCharSlew_ = 0;
   double maxCharCap_ = 0;
+  std::string charCacheDir_;
   double sinkBufferInputCap_ = 0;
   int capSteps_ = 20;
   int slewSteps_ = 7;
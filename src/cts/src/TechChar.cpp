@@ -35,7 +35,11 @@
 
 #include "TechChar.h"
 
+#include <unistd.h>
+
 #include <algorithm>
+#include <cstdio>
+#include <filesystem>
 #include <fstream>
 #include <iomanip>
 #include <ostream>
@@ -1545,6 +1549,37 @@ void TechChar::create()
 {
   // Setup of the attributes required to run the characterization.
   initCharacterization();
+  std::vector<ResultData> convertedSolutions;
+  std::string cacheKey;
+  std::string cachePath;
+  if (!options_->getCharCacheDir().empty()) {
+    cacheKey = getCharCacheKey();
+    cachePath = fmt::format("{}/cts_char_{:016x}.txt",
+                            options_->getCharCacheDir(),
+                            hashCharCacheKey(cacheKey));
+  }
+  if (cachePath.empty()
+      || !readCharCache(cachePath, cacheKey, convertedSolutions)) {
+    characterizeSegments();
+    // Post-processing of the results.
+    convertedSolutions = characterizationPostProcess();
+    if (!cachePath.empty()) {
+      writeCharCache(cachePath, cacheKey, convertedSolutions);
+    }
+  }
+  compileLut(convertedSolutions);
+  if (logger_->debugCheck(CTS, "characterization", 3)
+      && !solutionMap_.empty()) {
+    printCharacterization();
+    printSolution();
+  }
+  odb::dbBlock::destroy(charBlock_);
+}
+
+// Runs STA on every topology, load and input slew combination and
+// collects the results in solutionMap_.
+void TechChar::characterizeSegments()
+{
   long unsigned int topologiesCreated = 0;
   for (unsigned setupWirelength : wirelengthsToTest_) {
     // Creates the topologies for the current wirelength.
@@ -1678,15 +1713,156 @@ void TechChar::create()
     logger_->info(
         CTS, 39, "Number of created patterns = {}.", topologiesCreated);
   }
-  // Post-processing of the results.
-  const std::vector<ResultData> convertedSolutions
-      = characterizationPostProcess();
-  compileLut(convertedSolutions);
-  if (logger_->debugCheck(CTS, "characterization", 3)) {
-    printCharacterization();
-    printSolution();
+}
+
+// Everything the characterization results depend on: the buffers and their
+// liberty models, the clock wire RC and the wirelengths, loads and slews
+// that are swept.
+std::string TechChar::getCharCacheKey() const
+{
+  std::string key = fmt::format("v{}|{}|{}|{}|{}|{}|{}\n",
+                                char_cache_version,
+                                db_->getChip()->getBlock()->getDbUnitsPerMicron(),
+                                resPerDBU_,
+                                capPerDBU_,
+                                options_->getWireSegmentUnit(),
+                                charSlewStepSize_,
+                                charCapStepSize_);
+  for (const std::string& name : masterNames_) {
+    odb::dbMaster* master = db_->findMaster(name.c_str());
+    sta::LibertyCell* libCell
+        = db_network_->libertyCell(db_network_->dbToSta(master));
+    key += fmt::format("B{}|{}", name, master->getHeight());
+    if (libCell) {
+      const char* fileName = libCell->libertyLibrary()->filename();
+      std::error_code ec;
+      const auto size = std::filesystem::file_size(fileName, ec);
+      const auto mtime = std::filesystem::last_write_time(fileName, ec);
+      key += fmt::format("|{}|{}|{}|{}",
+                         fileName,
+                         ec ? 0 : size,
+                         mtime.time_since_epoch().count(),
+                         libCell->area());
+      sta::LibertyPort *input, *output;
+      libCell->bufferPorts(input, output);
+      if (input) {
+        key += fmt::format("|{}", input->capacitance());
+      }
+    }
+    key += '\n';
   }
-  odb::dbBlock::destroy(charBlock_);
+  for (const float wirelength : wirelengthsToTest_) {
+    key += fmt::format("W{}", wirelength);
+  }
+  for (const float load : loadsToTest_) {
+    key += fmt::format("L{}", load);
+  }
+  for (const float slew : slewsToTest_) {
+    key += fmt::format("S{}", slew);
+  }
+  return key;
+}
+
+// FNV-1a, only used to name the cache file.
+uint64_t TechChar::hashCharCacheKey(const std::string& key)
+{
+  uint64_t hash = 14695981039346656037ULL;
+  for (const char c : key) {
+    hash ^= static_cast<unsigned char>(c);
+    hash *= 1099511628211ULL;
+  }
+  return hash;
+}
+
+bool TechChar::readCharCache(const std::string& path,
+                             const std::string& key,
+                             std::vector<ResultData>& results)
+{
+  std::ifstream file(path);
+  if (!file.good()) {
+    return false;
+  }
+  size_t keySize = 0;
+  file >> keySize;
+  file.get();
+  std::string fileKey(keySize, '\0');
+  file.read(fileKey.data(), keySize);
+  if (!file || fileKey != key) {
+    return false;
+  }
+  size_t numResults = 0;
+  file >> minSlew_ >> maxSlew_ >> minCapacitance_ >> maxCapacitance_
+      >> minSegmentLength_ >> maxSegmentLength_ >> numResults;
+  results.clear();
+  results.reserve(numResults);
+  for (size_t i = 0; i < numResults && file; ++i) {
+    ResultData result;
+    size_t topologySize = 0;
+    file >> result.load >> result.inSlew >> result.wirelength
+        >> result.pinSlew >> result.pinArrival >> result.totalcap
+        >> result.totalPower >> result.isPureWire >> topologySize;
+    result.topology.resize(topologySize);
+    for (std::string& node : result.topology) {
+      file >> node;
+    }
+    results.push_back(std::move(result));
+  }
+  if (!file) {
+    logger_->warn(
+        CTS, 126, "Ignoring unreadable characterization cache {}.", path);
+    results.clear();
+    return false;
+  }
+  // The file name depends on the liberty timestamps; the directory is
+  // what the user asked for and keeps the message stable.
+  logger_->info(CTS,
+                127,
+                "Loaded characterization from cache directory {}.",
+                options_->getCharCacheDir());
+  return true;
+}
+
+void TechChar::writeCharCache(const std::string& path,
+                              const std::string& key,
+                              const std::vector<ResultData>& results) const
+{
+  // Write to a private file and rename it so that concurrent runs sharing
+  // the cache directory never read a partial file.
+  const std::string tmpPath = fmt::format("{}.{}", path, getpid());
+  {
+    std::ofstream file(tmpPath);
+    if (!file.good()) {
+      logger_->warn(
+          CTS, 128, "Unable to write characterization cache {}.", path);
+      return;
+    }
+    file << key.size() << '\n' << key << '\n';
+    file << fmt::format("{} {} {} {} {} {} {}\n",
+                        minSlew_,
+                        maxSlew_,
+                        minCapacitance_,
+                        maxCapacitance_,
+                        minSegmentLength_,
+                        maxSegmentLength_,
+                        results.size());
+    for (const ResultData& result : results) {
+      file << fmt::format("{} {} {} {} {} {} {} {} {}",
+                          result.load,
+                          result.inSlew,
+                          result.wirelength,
+                          result.pinSlew,
+                          result.pinArrival,
+                          result.totalcap,
+                          result.totalPower,
+                          static_cast<int>(result.isPureWire),
+                          result.topology.size());
+      for (const std::string& node : result.topology) {
+        file << ' ' << node;
+      }
+      file << '\n';
+    }
+  }
+  std::rename(tmpPath.c_str(), path.c_str());
 }
 
 // Compute possible buffering solution combinations given #buffers and
@@ -301,7 +301,16 @@ class TechChar
   void swapTopologyBuffer(SolutionData& solution,
                           unsigned nodeIndex,
                           const std::string& newMasterName);
+  void characterizeSegments();
   std::vector<ResultData> characterizationPostProcess();
+  std::string getCharCacheKey() const;
+  static uint64_t hashCharCacheKey(const std::string& key);
+  bool readCharCache(const std::string& path,
+                     const std::string& key,
+                     std::vector<ResultData>& results);
+  void writeCharCache(const std::string& path,
+                      const std::string& key,
+                      const std::vector<ResultData>& results) const;
   unsigned normalizeCharResults(float value,
                                 float iter,
                                 unsigned* min,
@@ -310,6 +319,8 @@ class TechChar
   unsigned getBufferingCombo(size_t numBuffers, size_t numNodes);
   bool isTopologyMonotonic(const std::vector<size_t>& row);
 
+  // Bump when the characterization changes so stale caches are ignored.
+  static constexpr int char_cache_version = 1;
   static constexpr unsigned NUM_BITS_PER_FIELD = 10;
   static constexpr unsigned MAX_NORMALIZED_VAL = (1 << NUM_BITS_PER_FIELD) - 1;
 
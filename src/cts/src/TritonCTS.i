@@ -84,6 +84,12 @@ set_max_char_cap(double cap)
   getTritonCts()->getParms()->setMaxCharCap(cap);
 }
 
+void
+set_char_cache_dir(const char* dir)
+{
+  getTritonCts()->getParms()->setCharCacheDir(dir);
+}
+
 void
 set_max_char_slew(double slew)
 {
@@ -7,6 +7,7 @@ record_tests {
   no_clocks
   no_sinks
   simple_test
+  simple_test_char_cache
   simple_test_clustered
   simple_test_clustered_max_cap
   check_wire_rc_cts
@@ -0,0 +1,17 @@
+# Run simple_test twice in separate processes sharing a characterization
+# cache. The second run must load the cache and build the same tree.
+source "helpers.tcl"
+
+set cache_dir results/char_cache
+file delete -force $cache_dir
+file mkdir $cache_dir
+
+set OR $argv0
+foreach run {1 2} {
+  puts "Run $run"
+  flush stdout
+  exec $OR -no_init -no_splash -exit simple_test_char_cache_run.tcl \
+    >@ stdout 2>@ stdout
+}
+
+puts "Cache files: [llength [glob -directory $cache_dir cts_char_*.txt]]"
@@ -990,9 +990,18 @@ bool Opendp::checkPixels(const Cell* cell,
   if (x_end > row_info.second.getSiteCount()) {
     return false;
   }
-  if (!checkRegionOverlap(cell, x, y, x_end, y_end)) {
-    return false;
-  }
+  // The region check is an rtree query while the pixel checks are plain
+  // grid lookups, and most candidate positions fail on an occupied pixel.
+  // Every check below can only reject, so the rtree query is deferred
+  // until the pixels have passed (or a null site needs to be reported).
+  bool region_checked = false;
+  auto regionOk = [&]() {
+    if (!region_checked) {
+      region_checked = true;
+      return checkRegionOverlap(cell, x, y, x_end, y_end);
+    }
+    return true;
+  };
   const auto cell_site = cell->getSite();
   const int layer = row_info.second.getGridIndex();
   for (GridY y1 = y; y1 < y_end; y1++) {
@@ -1005,6 +1014,9 @@ bool Opendp::checkPixels(const Cell* cell,
         return false;
       }
       if (pixel->site == nullptr) {
+        if (!regionOk()) {
+          return false;
+        }
         logger_->error(DPL, 1599, "Pixel site is null");
       }
     }
@@ -1076,7 +1088,7 @@ bool Opendp::checkPixels(const Cell* cell,
       }
     }
   }
-  return true;
+  return regionOk();
 }
 
 ////////////////////////////////////////////////////////////////
@@ -99,6 +99,7 @@ struct ParamStruct
   int minAccessPoints = -1;
   bool saveGuideUpdates = false;
   std::string repairPDNLayerName;
+  std::string pinAccessCacheDir;
 };
 
 class TritonRoute
@@ -57,6 +57,7 @@ sta::define_cmd_args "detailed_route" {
     [-clean_patches]
     [-no_pin_access]
     [-min_access_points count]
+    [-pin_access_cache_dir dir]
     [-save_guide_updates]
     [-repair_pdn_vias layer]
     [-single_step_dr]
@@ -68,7 +69,8 @@ proc detailed_route { args } {
       -db_process_node -droute_end_iter -via_in_pin_bottom_layer \
       -via_in_pin_top_layer -or_seed -or_k -bottom_routing_layer \
       -top_routing_layer -verbose -remote_host -remote_port -shared_volume \
-      -cloud_size -min_access_points -repair_pdn_vias -drc_report_iter_step} \
+      -cloud_size -min_access_points -repair_pdn_vias -drc_report_iter_step \
+      -pin_access_cache_dir} \
     flags {-disable_via_gen -distributed -clean_patches -no_pin_access \
            -single_step_dr -save_guide_updates}
   sta::check_argc_eq0 "detailed_route" $args
@@ -192,12 +194,18 @@ proc detailed_route { args } {
   } else {
     set min_access_points -1
   }
+  if { [info exists keys(-pin_access_cache_dir)] } {
+    set pin_access_cache_dir $keys(-pin_access_cache_dir)
+  } else {
+    set pin_access_cache_dir ""
+  }
   drt::detailed_route_cmd $output_maze $output_drc $output_cmap \
     $output_guide_coverage $db_process_node $enable_via_gen $droute_end_iter \
     $via_in_pin_bottom_layer $via_in_pin_top_layer \
     $or_seed $or_k $bottom_routing_layer $top_routing_layer $verbose \
     $clean_patches $no_pin_access $single_step_dr $min_access_points \
-    $save_guide_updates $repair_pdn_vias $drc_report_iter_step
+    $save_guide_updates $repair_pdn_vias $drc_report_iter_step \
+    $pin_access_cache_dir
 }
 
 proc detailed_route_num_drvs { args } {
@@ -292,6 +300,7 @@ sta::define_cmd_args "pin_access" {
     [-bottom_routing_layer layer]
     [-top_routing_layer layer]
     [-min_access_points count]
+    [-pin_access_cache_dir dir]
     [-verbose level]
     [-distributed]
     [-remote_host rhost]
@@ -302,7 +311,8 @@ sta::define_cmd_args "pin_access" {
 proc pin_access { args } {
   sta::parse_key_args "pin_access" args \
     keys {-db_process_node -bottom_routing_layer -top_routing_layer -verbose \
-          -min_access_points -remote_host -remote_port -shared_volume -cloud_size } \
+          -min_access_points -remote_host -remote_port -shared_volume -cloud_size \
+          -pin_access_cache_dir } \
     flags {-distributed}
   sta::check_argc_eq0 "detailed_route_debug" $args
   if {[info exists keys(-db_process_node)]} {
@@ -332,6 +342,11 @@ proc pin_access { args } {
   } else {
     set min_access_points -1
   }
+  if { [info exists keys(-pin_access_cache_dir)] } {
+    set pin_access_cache_dir $keys(-pin_access_cache_dir)
+  } else {
+    set pin_access_cache_dir ""
+  }
   if { [info exists flags(-distributed)] } {
     if { [info exists keys(-remote_host)] } {
       set rhost $keys(-remote_host)
@@ -356,7 +371,7 @@ proc pin_access { args } {
     drt::detailed_route_distributed $rhost $rport $vol $cloudsz
   }
   drt::pin_access_cmd $db_process_node $bottom_routing_layer \
-    $top_routing_layer $verbose $min_access_points
+    $top_routing_layer $verbose $min_access_points $pin_access_cache_dir
 }
 
 sta::define_cmd_args "detailed_route_run_worker" {
@@ -142,11 +142,7 @@ class RoutingCallBack : public dst::JobCallBack
       t.print(logger_);
     }
     if (!desc->getViaData().empty()) {
-      std::stringstream stream(
-          desc->getViaData(),
-          std::ios_base::binary | std::ios_base::in | std::ios_base::out);
-      frIArchive ar(stream);
-      ar >> via_data_;
+      deserializeViaData(via_data_, desc->getViaData());
     }
     dist_->sendResult(result, sock);
     sock.close();
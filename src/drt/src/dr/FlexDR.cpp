@@ -34,6 +34,10 @@
 #include <boost/archive/text_iarchive.hpp>
 #include <boost/archive/text_oarchive.hpp>
 #include <boost/io/ios_state.hpp>
+#include <boost/iostreams/device/array.hpp>
+#include <boost/iostreams/device/back_inserter.hpp>
+#include <boost/iostreams/stream.hpp>
+#include <algorithm>
 #include <chrono>
 #include <cstdio>
 #include <fstream>
@@ -67,23 +71,30 @@ enum class SerializationType
   WRITE
 };
 
+// Workers and via data are archived straight into / out of the string
+// buffers that travel over the wire instead of staging them in a
+// std::stringstream, which costs an extra full copy in each direction.
+using StringSink = boost::iostreams::back_insert_device<std::string>;
+using StringSource = boost::iostreams::array_source;
+
 void serializeWorker(FlexDRWorker* worker, std::string& workerStr)
 {
-  std::stringstream stream(std::ios_base::binary | std::ios_base::in
-                           | std::ios_base::out);
-  frOArchive ar(stream);
-  registerTypes(ar);
-  ar << *worker;
-  workerStr = stream.str();
+  workerStr.clear();
+  boost::iostreams::stream<StringSink> stream(workerStr);
+  {
+    frOArchive ar(stream);
+    registerTypes(ar);
+    ar << *worker;
+  }
+  stream.flush();
 }
 
 void deserializeWorker(FlexDRWorker* worker,
                        frDesign* design,
                        const std::string& workerStr)
 {
-  std::stringstream stream(
-      workerStr,
-      std::ios_base::binary | std::ios_base::in | std::ios_base::out);
+  boost::iostreams::stream<StringSource> stream(workerStr.data(),
+                                                workerStr.size());
   frIArchive ar(stream);
   ar.setDesign(design);
   registerTypes(ar);
@@ -92,12 +103,23 @@ void deserializeWorker(FlexDRWorker* worker,
 
 void serializeViaData(const FlexDRViaData& viaData, std::string& serializedStr)
 {
-  std::stringstream stream(std::ios_base::binary | std::ios_base::in
-                           | std::ios_base::out);
-  frOArchive ar(stream);
-  registerTypes(ar);
-  ar << viaData;
-  serializedStr = stream.str();
+  serializedStr.clear();
+  boost::iostreams::stream<StringSink> stream(serializedStr);
+  {
+    frOArchive ar(stream);
+    registerTypes(ar);
+    ar << viaData;
+  }
+  stream.flush();
+}
+
+void deserializeViaData(FlexDRViaData& viaData,
+                        const std::string& serializedStr)
+{
+  boost::iostreams::stream<StringSource> stream(serializedStr.data(),
+                                                serializedStr.size());
+  frIArchive ar(stream);
+  ar >> viaData;
 }
 
 FlexDR::FlexDR(TritonRoute* router,
@@ -118,7 +140,11 @@ FlexDR::FlexDR(TritonRoute* router,
 {
 }
 
-FlexDR::~FlexDR() = default;
+FlexDR::~FlexDR()
+{
+  // Also covers runs that stopped before end(true).
+  FlexGridGraph::releaseGridStoragePools();
+}
 
 void FlexDR::setDebug(frDebugSettings* settings)
 {
@@ -549,6 +575,30 @@ FlexDR::initDR_mergeBoundaryPin(int startX,
   return bp;
 }
 
+// Order in which the workers of a batch are started. The workers only read
+// the design in main() and their results are committed by end() afterwards
+// in the original order, so the start order does not change the result.
+// Workers with more violations in their drc box do more rip-up and reroute,
+// so they are started first to keep the longest ones out of the batch tail.
+static std::vector<int> getWorkerOrder(
+    const frDesign* design,
+    const std::vector<std::unique_ptr<FlexDRWorker>>& workers)
+{
+  std::vector<int> num_markers(workers.size(), 0);
+#pragma omp parallel for schedule(dynamic)
+  for (int i = 0; i < (int) workers.size(); i++) {  // NOLINT
+    std::vector<frMarker*> result;
+    design->getRegionQuery()->queryMarker(workers[i]->getDrcBox(), result);
+    num_markers[i] = result.size();
+  }
+  std::vector<int> order(workers.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(order.begin(), order.end(), [&num_markers](int a, int b) {
+    return num_markers[a] > num_markers[b];
+  });
+  return order;
+}
+
 void FlexDR::getBatchInfo(int& batchStepX, int& batchStepY)
 {
   batchStepX = 2;
@@ -702,8 +752,11 @@ void FlexDR::searchRepair(const SearchRepairArgs& args)
           ProfileTask task("DIST: PROCESS_BATCH");
           // multi thread
           ThreadException exception;
+          const std::vector<int> order
+              = getWorkerOrder(getDesign(), workersInBatch);
 #pragma omp parallel for schedule(dynamic)
-          for (int i = 0; i < (int) workersInBatch.size(); i++) {  // NOLINT
+          for (int k = 0; k < (int) order.size(); k++) {  // NOLINT
+            const int i = order[k];
             try {
               if (dist_on_) {
                 workersInBatch[i]->distributedMain(getDesign());
@@ -870,6 +923,11 @@ void FlexDR::searchRepair(const SearchRepairArgs& args)
 
 void FlexDR::end(bool done)
 {
+  if (done) {
+    // The worker threads keep their largest grid graph buffers for the
+    // next worker; hand them back once routing is over.
+    FlexGridGraph::releaseGridStoragePools();
+  }
   if (done && DRC_RPT_FILE != std::string("")) {
     router_->reportDRC(DRC_RPT_FILE, design_->getTopBlock()->getMarkers());
   }
@@ -1300,7 +1358,7 @@ void FlexDR::sendWorkers(
     for (auto& [idx, worker] : remote_batch) {
       std::string workerStr;
       serializeWorker(worker, workerStr);
-      workers.emplace_back(idx, workerStr);
+      workers.emplace_back(idx, std::move(workerStr));
     }
   }
   std::string remote_ip = dist_ip_;
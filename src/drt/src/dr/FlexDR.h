@@ -74,6 +74,10 @@ struct FlexDRViaData
   friend class boost::serialization::access;
 };
 
+void serializeViaData(const FlexDRViaData& viaData, std::string& serializedStr);
+void deserializeViaData(FlexDRViaData& viaData,
+                        const std::string& serializedStr);
+
 class FlexDR
 {
  public:
@@ -70,24 +70,109 @@ void FlexGridGraph::initGrids(
   getDim(xDim, yDim, zDim);
   const int capacity = xDim * yDim * zDim;
 
-  nodes_.clear();
-  nodes_.resize(capacity, Node());
-  // new
-  prevDirs_.clear();
-  srcs_.clear();
-  dsts_.clear();
-
-  prevDirs_.resize(capacity * 3, false);
-  srcs_.resize(capacity, false);
-  dsts_.resize(capacity, false);
-  guides_.clear();
-  if (followGuide) {
-    guides_.resize(capacity, false);
-  } else {
-    guides_.resize(capacity, true);
+  acquireGridStorage(capacity, followGuide);
+}
+
+namespace {
+
+// Take over the pooled buffer if it is larger than what v already holds.
+template <typename T>
+void takePooled(T& v, T& pooled)
+{
+  if (pooled.capacity() > v.capacity()) {
+    v.swap(pooled);
+  }
+  pooled.clear();
+}
+
+// Keep the larger of the two buffers in the pool and free the other one.
+template <typename T>
+void returnToPool(T& v, T& pooled)
+{
+  if (v.capacity() > pooled.capacity()) {
+    v.swap(pooled);
+  }
+  pooled.clear();
+  v.clear();
+  v.shrink_to_fit();
+}
+
+}  // namespace
+
+FlexGridGraph::GridStoragePool::GridStoragePool()
+{
+  auto& registry = getGridStoragePools();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  registry.pools.insert(this);
+}
+
+FlexGridGraph::GridStoragePool::~GridStoragePool()
+{
+  auto& registry = getGridStoragePools();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  registry.pools.erase(this);
+}
+
+void FlexGridGraph::GridStoragePool::clear()
+{
+  frVector<Node>().swap(nodes);
+  std::vector<bool>().swap(prevDirs);
+  std::vector<bool>().swap(srcs);
+  std::vector<bool>().swap(dsts);
+  std::vector<bool>().swap(guides);
+}
+
+FlexGridGraph::GridStoragePool& FlexGridGraph::getGridStoragePool()
+{
+  thread_local GridStoragePool pool;
+  return pool;
+}
+
+FlexGridGraph::GridStoragePools& FlexGridGraph::getGridStoragePools()
+{
+  static GridStoragePools pools;
+  return pools;
+}
+
+void FlexGridGraph::releaseGridStoragePools()
+{
+  auto& registry = getGridStoragePools();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  for (GridStoragePool* pool : registry.pools) {
+    std::lock_guard<std::mutex> pool_lock(pool->mutex);
+    pool->clear();
   }
 }
 
+void FlexGridGraph::acquireGridStorage(int capacity, bool followGuide)
+{
+  auto& pool = getGridStoragePool();
+  std::unique_lock<std::mutex> lock(pool.mutex);
+  takePooled(nodes_, pool.nodes);
+  takePooled(prevDirs_, pool.prevDirs);
+  takePooled(srcs_, pool.srcs);
+  takePooled(dsts_, pool.dsts);
+  takePooled(guides_, pool.guides);
+  lock.unlock();
+
+  nodes_.assign(capacity, Node());
+  prevDirs_.assign(capacity * 3, false);
+  srcs_.assign(capacity, false);
+  dsts_.assign(capacity, false);
+  guides_.assign(capacity, !followGuide);
+}
+
+void FlexGridGraph::releaseGridStorage()
+{
+  auto& pool = getGridStoragePool();
+  std::lock_guard<std::mutex> lock(pool.mutex);
+  returnToPool(nodes_, pool.nodes);
+  returnToPool(prevDirs_, pool.prevDirs);
+  returnToPool(srcs_, pool.srcs);
+  returnToPool(dsts_, pool.dsts);
+  returnToPool(guides_, pool.guides);
+}
+
 bool FlexGridGraph::outOfDieVia(frMIdx x,
                                 frMIdx y,
                                 frMIdx z,
@@ -32,6 +32,8 @@
 #include <cstring>
 #include <iostream>
 #include <map>
+#include <mutex>
+#include <set>
 
 #include "FlexMazeTypes.h"
 #include "db/drObj/drPin.h"
@@ -860,14 +862,7 @@ class FlexGridGraph
   int nTracksY() { return yCoords_.size(); }
   void cleanup()
   {
-    nodes_.clear();
-    nodes_.shrink_to_fit();
-    srcs_.clear();
-    srcs_.shrink_to_fit();
-    dsts_.clear();
-    dsts_.shrink_to_fit();
-    guides_.clear();
-    guides_.shrink_to_fit();
+    releaseGridStorage();
     xCoords_.clear();
     xCoords_.shrink_to_fit();
     yCoords_.clear();
@@ -881,6 +876,9 @@ class FlexGridGraph
     wavefront_.cleanup();
     wavefront_.fit();
   }
+  // Frees the storage pooled by cleanup() on every thread.  Only call it
+  // while no worker is being set up or cleaned up.
+  static void releaseGridStoragePools();
 
   void printNode(frMIdx x, frMIdx y, frMIdx z)
   {
@@ -960,6 +958,32 @@ class FlexGridGraph
 #ifndef DEBUG_DRT_UNDERFLOW
   static_assert(sizeof(Node) == 12);
 #endif
+  // Per-thread storage handed back by cleanup() so that the next worker
+  // routed on the same thread can reuse it instead of reallocating.
+  struct GridStoragePool
+  {
+    GridStoragePool();
+    ~GridStoragePool();
+    void clear();
+
+    std::mutex mutex;  // owner thread vs releaseGridStoragePools
+    frVector<Node> nodes;
+    std::vector<bool> prevDirs;
+    std::vector<bool> srcs;
+    std::vector<bool> dsts;
+    std::vector<bool> guides;
+  };
+  // Every live pool, so that they can be freed from the main thread.
+  struct GridStoragePools
+  {
+    std::mutex mutex;
+    std::set<GridStoragePool*> pools;
+  };
+  static GridStoragePool& getGridStoragePool();
+  static GridStoragePools& getGridStoragePools();
+  void acquireGridStorage(int capacity, bool followGuide);
+  void releaseGridStorage();
+
   frVector<Node> nodes_;
   std::vector<bool> prevDirs_;
   std::vector<bool> srcs_;
@@ -28,9 +28,11 @@
 
 #pragma once
 
+#include <algorithm>
 #include <bitset>
+#include <cstdint>
 #include <memory>
-#include <queue>
+#include <vector>
 
 #include "dr/FlexMazeTypes.h"
 #include "frBaseTypes.h"
@@ -84,6 +86,7 @@ class FlexWavefrontGrid
   frMIdx z() const { return zIdx_; }
   frCost getPathCost() const { return pathCost_; }
   frCost getCost() const { return cost_; }
+  frCoord getDist() const { return dist_; }
   const std::bitset<WAVEFRONTBITSIZE>& getBackTraceBuffer() const
   {
     return backTraceBuffer_;
@@ -139,29 +142,78 @@ class FlexWavefrontGrid
   const frBox3D* srcTaperBox = nullptr;
 };
 
-class myPriorityQueue : public std::priority_queue<FlexWavefrontGrid>
+// The heap only moves small keys around; the full wavefront records (with
+// their backtrace buffers) stay put in a slot pool that is recycled as grids
+// are popped.  The key ordering mirrors FlexWavefrontGrid::operator< and the
+// heap is maintained with the same std::push_heap/std::pop_heap calls that
+// std::priority_queue uses, so the pop order is unchanged.
+class FlexWavefront
 {
  public:
-  void cleanup() { this->c.clear(); }
+  bool empty() const { return heap_.empty(); }
+  const FlexWavefrontGrid& top() const { return grids_[heap_.front().slot]; }
+  void pop()
+  {
+    std::pop_heap(heap_.begin(), heap_.end());
+    freeSlots_.push_back(heap_.back().slot);
+    heap_.pop_back();
+  }
+  void push(const FlexWavefrontGrid& in)
+  {
+    uint32_t slot;
+    if (freeSlots_.empty()) {
+      slot = grids_.size();
+      grids_.push_back(in);
+    } else {
+      slot = freeSlots_.back();
+      freeSlots_.pop_back();
+      grids_[slot] = in;
+    }
+    heap_.push_back(
+        {in.getCost(), in.getDist(), in.z(), in.getPathCost(), slot});
+    std::push_heap(heap_.begin(), heap_.end());
+  }
+  unsigned int size() const { return heap_.size(); }
+  void cleanup()
+  {
+    heap_.clear();
+    grids_.clear();
+    freeSlots_.clear();
+  }
   void fit()
   {
-    this->c.clear();
-    this->c.shrink_to_fit();
+    cleanup();
+    heap_.shrink_to_fit();
+    grids_.shrink_to_fit();
+    freeSlots_.shrink_to_fit();
   }
-};
-
-class FlexWavefront
-{
- public:
-  bool empty() const { return wavefrontPQ_.empty(); }
-  const FlexWavefrontGrid& top() const { return wavefrontPQ_.top(); }
-  void pop() { wavefrontPQ_.pop(); }
-  void push(const FlexWavefrontGrid& in) { wavefrontPQ_.push(in); }
-  unsigned int size() const { return wavefrontPQ_.size(); }
-  void cleanup() { wavefrontPQ_.cleanup(); }
-  void fit() { wavefrontPQ_.fit(); }
 
  private:
-  myPriorityQueue wavefrontPQ_;
+  struct Key
+  {
+    frCost cost;
+    frCoord dist;
+    frMIdx z;
+    frCost pathCost;
+    uint32_t slot;
+
+    bool operator<(const Key& b) const
+    {
+      if (cost != b.cost) {
+        return cost > b.cost;
+      }
+      if (dist != b.dist) {
+        return dist > b.dist;
+      }
+      if (z != b.z) {
+        return z < b.z;
+      }
+      return pathCost < b.pathCost;
+    }
+  };
+
+  std::vector<Key> heap_;
+  std::vector<FlexWavefrontGrid> grids_;
+  std::vector<uint32_t> freeSlots_;
 };
 }  // namespace drt
@@ -111,6 +111,7 @@ void FlexPA::prep()
   ProfileTask profile("PA:prep");
   prepPoint();
   revertAccessPoints();
+  saveAccessPointCache();
   if (isDistributed()) {
     std::vector<paUpdate> updates;
     paUpdate update;
@@ -70,6 +70,7 @@ class FlexPA
   ~FlexPA();
 
   void setDebug(frDebugSettings* settings, odb::dbDatabase* db);
+  void setDb(odb::dbDatabase* db) { db_ = db; }
   void setTargetInstances(const frCollection<odb::dbInst*>& insts);
   void setDistributed(const std::string& rhost,
                       uint16_t rport,
@@ -82,6 +83,7 @@ class FlexPA
   frDesign* design_;
   Logger* logger_;
   dst::Distributed* dist_;
+  odb::dbDatabase* db_ = nullptr;
 
   std::unique_ptr<FlexPAGraphics> graphics_;
   std::string debugPinName_;
@@ -113,6 +115,25 @@ class FlexPA
   std::string shared_vol_;
   int cloud_sz_;
 
+  // access point cache, keyed by unique instance class
+  struct ApCacheEntry
+  {
+    std::vector<std::unique_ptr<frPinAccess>> pin_access;
+    // candidate points generated for the class, replayed into the stats
+    int gen_ap_cnt = 0;
+
+    template <class Archive>
+    void serialize(Archive& ar, const unsigned int version)
+    {
+      (ar) & pin_access;
+      (ar) & gen_ap_cnt;
+    }
+  };
+  std::map<std::string, ApCacheEntry> ap_cache_;
+  std::vector<std::string> ap_cache_keys_;
+  std::vector<int> ap_cache_gen_cnts_;
+  std::string ap_cache_sig_;
+
   // helper functions
   frDesign* getDesign() const { return design_; }
   frTechObject* getTech() const { return design_->getTech(); }
@@ -132,6 +153,15 @@ class FlexPA
   void initTrackCoords();
   void initViaRawPriority();
   void initSkipInstTerm();
+  // access point cache
+  std::string getCacheSignature() const;
+  uint64_t getCacheContextHash() const;
+  std::string getCachePath() const;
+  std::string getMasterCacheKey(frMaster* master) const;
+  void initAccessPointCache();
+  bool applyCachedAccessPoints(frInst* inst, const std::string& key);
+  void updateCachedStat(frInst* inst, const ApCacheEntry& entry);
+  void saveAccessPointCache();
   // prep
   void prep();
   void prepPoint();
@@ -141,7 +171,9 @@ class FlexPA
       const gtl::polygon_90_set_data<frCoord>& polyset,
       std::vector<std::pair<int, frViaDef*>>& viaDefs);
   template <typename T>
-  int prepPoint_pin(T* pin, frInstTerm* instTerm = nullptr);
+  int prepPoint_pin(T* pin,
+                    frInstTerm* instTerm = nullptr,
+                    int* genApCnt = nullptr);
   template <typename T>
   void prepPoint_pin_mergePinShapes(
       std::vector<gtl::polygon_90_set_data<frCoord>>& pinShapes,
@@ -284,7 +316,8 @@ class FlexPA
       T* pin,
       frInstTerm* instTerm,
       frAccessPointEnum lowerType,
-      frAccessPointEnum upperType);
+      frAccessPointEnum upperType,
+      int& nGenAps);
 
   void prepPattern();
   void prepPatternInstRows(std::vector<std::vector<frInst*>> inst_rows);
@@ -0,0 +1,416 @@
+/*
+ * Copyright (c) 2024, The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the University nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE REGENTS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <unistd.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+#include "FlexPA.h"
+#include "distributed/frArchive.h"
+#include "odb/db.h"
+#include "odb/lefout.h"
+#include "serialization.h"
+
+namespace drt {
+
+// Bump whenever the access point generation changes in a way that makes
+// previously cached results stale.
+static constexpr int pa_cache_version = 2;
+
+static void appendFig(std::string& key, const frPinFig* fig)
+{
+  const Rect box = fig->getBBox();
+  key += fmt::format("{}:{},{},{},{}",
+                     static_cast<const frShape*>(fig)->getLayerNum(),
+                     box.xMin(),
+                     box.yMin(),
+                     box.xMax(),
+                     box.yMax());
+  if (fig->typeId() == frcPolygon) {
+    for (const Point& pt : static_cast<const frPolygon*>(fig)->getPoints()) {
+      key += fmt::format(":{},{}", pt.x(), pt.y());
+    }
+  }
+  key += ';';
+}
+
+static constexpr uint64_t fnv_offset_basis = 14695981039346656037ULL;
+
+// FNV-1a, used to derive a stable file name from the signature and to
+// fingerprint the design context without materializing it as a string.
+static void hashBytes(uint64_t& hash, const void* data, size_t size)
+{
+  const auto* bytes = static_cast<const unsigned char*>(data);
+  for (size_t i = 0; i < size; i++) {
+    hash ^= bytes[i];
+    hash *= 1099511628211ULL;
+  }
+}
+
+static uint64_t hashString(const std::string& str)
+{
+  uint64_t hash = fnv_offset_basis;
+  hashBytes(hash, str.data(), str.size());
+  return hash;
+}
+
+static void hashRect(uint64_t& hash, const frLayerNum layerNum, const Rect& box)
+{
+  const int values[] = {
+      layerNum, box.xMin(), box.yMin(), box.xMax(), box.yMax()};
+  hashBytes(hash, values, sizeof(values));
+}
+
+// Everything outside of the masters that access point generation depends
+// on: the PA options, track patterns, the tech rules and the fixed shapes
+// of the design that the points are checked against.
+std::string FlexPA::getCacheSignature() const
+{
+  std::string sig = fmt::format("v{}|{}|{}|{}|{}|{}|{}|{}|{}|{}|{}|{}\n",
+                                pa_cache_version,
+                                DBPROCESSNODE,
+                                getTech()->getDBUPerUU(),
+                                getTech()->getManufacturingGrid(),
+                                BOTTOM_ROUTING_LAYER,
+                                TOP_ROUTING_LAYER,
+                                VIAINPIN_BOTTOMLAYERNUM,
+                                VIAINPIN_TOPLAYERNUM,
+                                MINNUMACCESSPOINT_STDCELLPIN,
+                                MINNUMACCESSPOINT_MACROCELLPIN,
+                                USENONPREFTRACKS,
+                                AUTO_TAPER_NDR_NETS);
+  for (const auto& layer : getTech()->getLayers()) {
+    sig += fmt::format("L{}:{}:{}:{}:{}:{}\n",
+                       layer->getName(),
+                       static_cast<int>(layer->getType().getValue()),
+                       static_cast<int>(layer->getDir().getValue()),
+                       layer->getWidth(),
+                       layer->getMinWidth(),
+                       layer->getPitch());
+    for (const auto& tp :
+         getDesign()->getTopBlock()->getTrackPatterns(layer->getLayerNum())) {
+      sig += fmt::format("T{}:{}:{}:{}\n",
+                         tp->isHorizontal(),
+                         tp->getStartCoord(),
+                         tp->getTrackSpacing(),
+                         tp->getNumTracks());
+    }
+  }
+  for (const auto& via : getTech()->getVias()) {
+    sig += fmt::format("V{}:", via->getName());
+    for (const auto& fig : via->getLayer1Figs()) {
+      appendFig(sig, fig.get());
+    }
+    for (const auto& fig : via->getCutFigs()) {
+      appendFig(sig, fig.get());
+    }
+    for (const auto& fig : via->getLayer2Figs()) {
+      appendFig(sig, fig.get());
+    }
+    sig += '\n';
+  }
+  sig += 'C';
+  for (int i = 0;; i++) {
+    const frConstraint* con = getTech()->getConstraint(i);
+    if (con == nullptr) {
+      break;
+    }
+    sig += fmt::format("{},", static_cast<int>(con->typeId()));
+  }
+  // The rule values themselves are taken from the LEF dump of the tech,
+  // which includes the spacing tables, enclosures and the LEF58 properties
+  // the frConstraints above are built from.
+  std::ostringstream tech_lef;
+  odb::lefout writer(logger_, tech_lef);
+  writer.writeTech(db_->getTech());
+  sig += fmt::format("\nR{:016x}", hashString(tech_lef.str()));
+  sig += fmt::format("\nD{:016x}\n", getCacheContextHash());
+  return sig;
+}
+
+// Fingerprint of the fixed block level shapes that initPA checks access
+// points against: special nets (PDN), routing blockages and IO pins.
+// Neighbouring instances are not part of it.  Each unique instance class
+// is solved on a single representative instance whose placement is
+// already arbitrary within the class, so the cached points carry the same
+// assumption an uncached run makes.
+uint64_t FlexPA::getCacheContextHash() const
+{
+  uint64_t hash = fnv_offset_basis;
+  const frBlock* block = getDesign()->getTopBlock();
+  const Rect die = block->getDieBox();
+  hashRect(hash, 0, die);
+  for (const auto& snet : block->getSNets()) {
+    hashBytes(hash, snet->getName().data(), snet->getName().size());
+    for (const auto& shape : snet->getShapes()) {
+      hashRect(hash, shape->getLayerNum(), shape->getBBox());
+    }
+    for (const auto& via : snet->getVias()) {
+      const frViaDef* viaDef = via->getViaDef();
+      hashBytes(hash, viaDef->getName().data(), viaDef->getName().size());
+      const Point origin = via->getOrigin();
+      hashRect(hash,
+               viaDef->getCutLayerNum(),
+               Rect(origin.x(), origin.y(), origin.x(), origin.y()));
+    }
+  }
+  for (const auto& blockage : block->getBlockages()) {
+    for (const auto& fig : blockage->getPin()->getFigs()) {
+      hashRect(hash,
+               static_cast<const frShape*>(fig.get())->getLayerNum(),
+               fig->getBBox());
+    }
+  }
+  for (const auto& term : block->getTerms()) {
+    for (const auto& pin : term->getPins()) {
+      for (const auto& fig : pin->getFigs()) {
+        hashRect(hash,
+                 static_cast<const frShape*>(fig.get())->getLayerNum(),
+                 fig->getBBox());
+      }
+    }
+  }
+  return hash;
+}
+
+std::string FlexPA::getCachePath() const
+{
+  return fmt::format(
+      "{}/pa_{:016x}.bin", PA_CACHE_DIR, hashString(ap_cache_sig_));
+}
+
+std::string FlexPA::getMasterCacheKey(frMaster* master) const
+{
+  std::string key = fmt::format(
+      "{}|{}|", master->getName(), master->getMasterType().getString());
+  for (const auto& term : master->getTerms()) {
+    key += fmt::format("T{}:", term->getName());
+    for (const auto& pin : term->getPins()) {
+      key += 'P';
+      for (const auto& fig : pin->getFigs()) {
+        appendFig(key, fig.get());
+      }
+    }
+  }
+  for (const auto& blockage : master->getBlockages()) {
+    key += 'B';
+    for (const auto& fig : blockage->getPin()->getFigs()) {
+      appendFig(key, fig.get());
+    }
+  }
+  return key;
+}
+
+// Builds the cache key of every unique instance and loads the cache file
+// matching the current design signature, if there is one.
+void FlexPA::initAccessPointCache()
+{
+  ap_cache_.clear();
+  ap_cache_keys_.clear();
+  ap_cache_gen_cnts_.clear();
+  ap_cache_sig_.clear();
+  // The tech dump needs the database, which distributed workers don't set.
+  if (PA_CACHE_DIR.empty() || db_ == nullptr) {
+    return;
+  }
+
+  std::map<frMaster*, std::string, frBlockObjectComp> master_keys;
+  const auto& unique = unique_insts_.getUnique();
+  ap_cache_keys_.resize(unique.size());
+  ap_cache_gen_cnts_.resize(unique.size(), 0);
+  for (int i = 0; i < (int) unique.size(); i++) {
+    frInst* inst = unique[i];
+    const std::vector<frCoord>* offsets = unique_insts_.getTrackOffsets(inst);
+    // NDR instances are not grouped into classes and the PA debugger wants
+    // to watch the points being generated, so neither uses the cache.
+    if (offsets == nullptr || graphics_) {
+      continue;
+    }
+    frMaster* master = inst->getMaster();
+    auto it = master_keys.find(master);
+    if (it == master_keys.end()) {
+      it = master_keys.emplace(master, getMasterCacheKey(master)).first;
+    }
+    std::string key = it->second;
+    key += fmt::format("|{}|", inst->getOrient().getString());
+    for (const frCoord offset : *offsets) {
+      key += fmt::format("{},", offset);
+    }
+    key += '|';
+    for (auto& instTerm : inst->getInstTerms()) {
+      key += isSkipInstTerm(instTerm.get()) ? '0' : '1';
+    }
+    ap_cache_keys_[i] = std::move(key);
+  }
+
+  ap_cache_sig_ = getCacheSignature();
+  const std::string path = getCachePath();
+  std::ifstream file(path, std::ios::binary);
+  if (!file.good()) {
+    return;
+  }
+  try {
+    frIArchive ar(file);
+    ar.setDesign(design_);
+    registerTypes(ar);
+    std::string sig;
+    ar >> sig;
+    if (sig != ap_cache_sig_) {
+      logger_->warn(DRT, 350, "Ignoring stale pin access cache {}.", path);
+      return;
+    }
+    ar >> ap_cache_;
+  } catch (const std::exception&) {
+    ap_cache_.clear();
+    logger_->warn(DRT, 351, "Ignoring unreadable pin access cache {}.", path);
+    return;
+  }
+  if (VERBOSE > 0) {
+    logger_->info(DRT,
+                  352,
+                  "Loaded {} cached unique instance classes from {}.",
+                  ap_cache_.size(),
+                  path);
+  }
+}
+
+// Fills in the access points of a unique instance from the cache.  Cached
+// points are relative to the instance origin, so they are shifted back to
+// the instance location where revertAccessPoints expects them.
+bool FlexPA::applyCachedAccessPoints(frInst* inst, const std::string& key)
+{
+  if (key.empty()) {
+    return false;
+  }
+  auto it = ap_cache_.find(key);
+  if (it == ap_cache_.end()) {
+    return false;
+  }
+  const auto& cached = it->second.pin_access;
+  size_t numPins = 0;
+  for (auto& instTerm : inst->getInstTerms()) {
+    numPins += instTerm->getTerm()->getPins().size();
+  }
+  if (numPins != cached.size()) {
+    return false;
+  }
+
+  const Point offset(inst->getTransform().getOffset());
+  const int paIdx = unique_insts_.getPAIndex(inst);
+  int pinIdx = 0;
+  for (auto& instTerm : inst->getInstTerms()) {
+    for (auto& pin : instTerm->getTerm()->getPins()) {
+      for (const auto& cachedAp : cached[pinIdx]->getAccessPoints()) {
+        auto ap = std::make_unique<frAccessPoint>(*cachedAp);
+        Point pt = ap->getPoint();
+        pt.addX(offset.x());
+        pt.addY(offset.y());
+        ap->setPoint(pt);
+        for (auto& ps : ap->getPathSegs()) {
+          Point begin = ps.getBeginPoint();
+          Point end = ps.getEndPoint();
+          begin.addX(offset.x());
+          begin.addY(offset.y());
+          end.addX(offset.x());
+          end.addY(offset.y());
+          ps.setPoints(begin, end);
+        }
+        pin->getPinAccess(paIdx)->addAccessPoint(std::move(ap));
+      }
+      pinIdx++;
+    }
+  }
+  updateCachedStat(inst, it->second);
+  return true;
+}
+
+// Adds the newly computed classes to the cache and rewrites the file.
+// Must be called after revertAccessPoints.
+void FlexPA::saveAccessPointCache()
+{
+  if (ap_cache_sig_.empty()) {
+    return;
+  }
+  const auto& unique = unique_insts_.getUnique();
+  int added = 0;
+  for (int i = 0; i < (int) unique.size(); i++) {
+    const std::string& key = ap_cache_keys_[i];
+    if (key.empty() || ap_cache_.find(key) != ap_cache_.end()) {
+      continue;
+    }
+    frInst* inst = unique[i];
+    const int paIdx = unique_insts_.getPAIndex(inst);
+    ApCacheEntry entry;
+    bool hasAps = false;
+    for (auto& instTerm : inst->getInstTerms()) {
+      for (auto& pin : instTerm->getTerm()->getPins()) {
+        entry.pin_access.push_back(
+            std::make_unique<frPinAccess>(*pin->getPinAccess(paIdx)));
+        hasAps |= entry.pin_access.back()->getNumAccessPoints() > 0;
+      }
+    }
+    // Classes skipped by prepPoint (eg fillers) have nothing worth keeping.
+    if (!hasAps) {
+      continue;
+    }
+    entry.gen_ap_cnt = ap_cache_gen_cnts_[i];
+    ap_cache_[key] = std::move(entry);
+    added++;
+  }
+  if (added == 0) {
+    return;
+  }
+
+  // Write to a private file and rename it so concurrent runs sharing the
+  // cache directory never see a partially written cache.
+  const std::string path = getCachePath();
+  const std::string tmp_path = fmt::format("{}.{}", path, getpid());
+  {
+    std::ofstream file(tmp_path, std::ios::binary);
+    if (!file.good()) {
+      logger_->warn(DRT, 353, "Unable to write pin access cache {}.", path);
+      return;
+    }
+    frOArchive ar(file);
+    registerTypes(ar);
+    ar << ap_cache_sig_;
+    ar << ap_cache_;
+  }
+  std::rename(tmp_path.c_str(), path.c_str());
+  if (VERBOSE > 0) {
+    logger_->info(DRT,
+                  354,
+                  "Saved {} new unique instance classes to {}.",
+                  added,
+                  path);
+  }
+}
+
+}  // namespace drt
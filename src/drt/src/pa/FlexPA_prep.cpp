@@ -1334,6 +1334,47 @@ void FlexPA::prepPoint_pin_updateStat(
   }
 }
 
+// Replays what prepPoint_pin records for the pins of a unique instance so
+// the PA statistics don't depend on whether the class came from the cache.
+void FlexPA::updateCachedStat(frInst* inst, const ApCacheEntry& entry)
+{
+  const dbMasterType masterType = inst->getMaster()->getMasterType();
+  const bool isStdCellPin = masterType == dbMasterType::CORE
+                            || masterType == dbMasterType::CORE_TIEHIGH
+                            || masterType == dbMasterType::CORE_TIELOW
+                            || masterType == dbMasterType::CORE_ANTENNACELL;
+  const bool isMacroCellPin = masterType.isBlock() || masterType.isPad()
+                              || masterType == dbMasterType::RING;
+  if (isStdCellPin) {
+#pragma omp atomic
+    stdCellPinGenApCnt_ += entry.gen_ap_cnt;
+  }
+  if (isMacroCellPin) {
+#pragma omp atomic
+    macroCellPinGenApCnt_ += entry.gen_ap_cnt;
+  }
+  int pinIdx = 0;
+  for (auto& instTerm : inst->getInstTerms()) {
+    for (auto& pin : instTerm->getTerm()->getPins()) {
+      const auto& aps = entry.pin_access[pinIdx++]->getAccessPoints();
+      if (isSkipInstTerm(instTerm.get())) {
+        continue;
+      }
+      prepPoint_pin_updateStat(aps, pin.get(), instTerm.get());
+      if (aps.empty()) {
+        if (isStdCellPin) {
+#pragma omp atomic
+          stdCellPinNoApCnt_++;
+        }
+        if (isMacroCellPin) {
+#pragma omp atomic
+          macroCellPinNoApCnt_++;
+        }
+      }
+    }
+  }
+}
+
 template <typename T>
 bool FlexPA::prepPoint_pin_helper(
     std::vector<std::unique_ptr<frAccessPoint>>& aps,
@@ -1342,7 +1383,8 @@ bool FlexPA::prepPoint_pin_helper(
     T* pin,
     frInstTerm* instTerm,
     const frAccessPointEnum lowerType,
-    const frAccessPointEnum upperType)
+    const frAccessPointEnum upperType,
+    int& nGenAps)
 {
   bool isStdCellPin = false;
   bool isMacroCellPin = false;
@@ -1363,6 +1405,7 @@ bool FlexPA::prepPoint_pin_helper(
   prepPoint_pin_genPoints(
       tmpAps, apset, pin, instTerm, pinShapes, lowerType, upperType);
   prepPoint_pin_checkPoints(tmpAps, pinShapes, pin, instTerm, isStdCellPin);
+  nGenAps += tmpAps.size();
   if (isStdCellPin) {
 #pragma omp atomic
     stdCellPinGenApCnt_ += tmpAps.size();
@@ -1432,7 +1475,7 @@ bool FlexPA::prepPoint_pin_helper(
 
 // first create all access points with costs
 template <typename T>
-int FlexPA::prepPoint_pin(T* pin, frInstTerm* instTerm)
+int FlexPA::prepPoint_pin(T* pin, frInstTerm* instTerm, int* genApCnt)
 {
   // aps are after xform
   // before checkPoints, ap->hasAccess(dir) indicates whether to check drc
@@ -1464,6 +1507,8 @@ int FlexPA::prepPoint_pin(T* pin, frInstTerm* instTerm)
   std::vector<gtl::polygon_90_set_data<frCoord>> pinShapes;
   prepPoint_pin_mergePinShapes(pinShapes, pin, instTerm);
 
+  int nGenAps = 0;
+
   for (auto upper : {frAccessPointEnum::OnGrid,
                      frAccessPointEnum::HalfGrid,
                      frAccessPointEnum::Center,
@@ -1479,12 +1524,19 @@ int FlexPA::prepPoint_pin(T* pin, frInstTerm* instTerm)
         continue;
       }
       if (prepPoint_pin_helper(
-              aps, apset, pinShapes, pin, instTerm, lower, upper)) {
+              aps, apset, pinShapes, pin, instTerm, lower, upper, nGenAps)) {
+        if (genApCnt) {
+          *genApCnt += nGenAps;
+        }
         return aps.size();
       }
     }
   }
 
+  if (genApCnt) {
+    *genApCnt += nGenAps;
+  }
+
   // instTerm aps are written back here if not early stopped
   // IO term aps are are written back in prepPoint_pin_helper and always early
   // stopped
@@ -1535,6 +1587,25 @@ void FlexPA::prepPoint()
   omp_set_num_threads(MAX_THREADS);
   ThreadException exception;
   const auto& unique = unique_insts_.getUnique();
+  initAccessPointCache();
+  int cached_cnt = 0;
+  auto updatePinCnt = [this, &cnt]() {
+#pragma omp critical
+    {
+      cnt++;
+      if (VERBOSE > 0) {
+        if (cnt < 10000) {
+          if (cnt % 1000 == 0) {
+            logger_->info(DRT, 76, "  Complete {} pins.", cnt);
+          }
+        } else {
+          if (cnt % 10000 == 0) {
+            logger_->info(DRT, 77, "  Complete {} pins.", cnt);
+          }
+        }
+      }
+    }
+  };
 #pragma omp parallel for schedule(dynamic)
   for (int i = 0; i < (int) unique.size(); i++) {  // NOLINT
     try {
@@ -1549,7 +1620,22 @@ void FlexPA::prepPoint()
           && masterType != dbMasterType::RING) {
         continue;
       }
+      if (!ap_cache_keys_.empty()
+          && applyCachedAccessPoints(inst, ap_cache_keys_[i])) {
+#pragma omp atomic
+        cached_cnt++;
+        // keep the pin count and its progress messages identical to an
+        // uncached run
+        for (auto& instTerm : inst->getInstTerms()) {
+          if (!isSkipInstTerm(instTerm.get())) {
+            updatePinCnt();
+          }
+        }
+        continue;
+      }
       ProfileTask profile("PA:uniqueInstance");
+      int* genApCnt = ap_cache_gen_cnts_.empty() ? nullptr
+                                                 : &ap_cache_gen_cnts_[i];
       for (auto& instTerm : inst->getInstTerms()) {
         // only do for normal and clock terms
         if (isSkipInstTerm(instTerm.get())) {
@@ -1557,7 +1643,7 @@ void FlexPA::prepPoint()
         }
         int nAps = 0;
         for (auto& pin : instTerm->getTerm()->getPins()) {
-          nAps += prepPoint_pin(pin.get(), instTerm.get());
+          nAps += prepPoint_pin(pin.get(), instTerm.get(), genApCnt);
         }
         if (!nAps) {
           logger_->error(DRT,
@@ -1566,21 +1652,7 @@ void FlexPA::prepPoint()
                          instTerm->getInst()->getName(),
                          instTerm->getTerm()->getName());
         }
-#pragma omp critical
-        {
-          cnt++;
-          if (VERBOSE > 0) {
-            if (cnt < 10000) {
-              if (cnt % 1000 == 0) {
-                logger_->info(DRT, 76, "  Complete {} pins.", cnt);
-              }
-            } else {
-              if (cnt % 10000 == 0) {
-                logger_->info(DRT, 77, "  Complete {} pins.", cnt);
-              }
-            }
-          }
-        }
+        updatePinCnt();
       }
     } catch (...) {
       exception.capture();
@@ -1621,6 +1693,12 @@ void FlexPA::prepPoint()
 
   if (VERBOSE > 0) {
     logger_->info(DRT, 78, "  Complete {} pins.", cnt);
+    if (cached_cnt > 0) {
+      logger_->info(DRT,
+                    355,
+                    "  Reused cached access points for {} unique instances.",
+                    cached_cnt);
+    }
   }
 }
 
@@ -180,6 +180,7 @@ void UniqueInsts::computeUnique(
       for (auto& [vec, insts] : offsetMap) {
         auto uniqueInst = *(insts.begin());
         unique_.push_back(uniqueInst);
+        unique2offsets_[uniqueInst] = &vec;
         for (auto i : insts) {
           inst2unique_[i] = uniqueInst;
           inst2Class_[i] = &insts;
@@ -307,6 +308,15 @@ int UniqueInsts::getPAIndex(frInst* inst) const
   return unique2paidx_.at(inst);
 }
 
+const std::vector<frCoord>* UniqueInsts::getTrackOffsets(frInst* unique) const
+{
+  auto it = unique2offsets_.find(unique);
+  if (it == unique2offsets_.end()) {
+    return nullptr;
+  }
+  return it->second;
+}
+
 const std::vector<frInst*>& UniqueInsts::getUnique() const
 {
   return unique_;
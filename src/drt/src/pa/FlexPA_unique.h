@@ -64,6 +64,9 @@ class UniqueInsts
   const std::vector<frInst*>& getUnique() const;
   frInst* getUnique(int idx) const;
   bool hasUnique(frInst* inst) const;
+  // Gets the track offsets that define the unique instance's class or
+  // nullptr if the instance is not part of a class (eg NDR instances)
+  const std::vector<frCoord>* getTrackOffsets(frInst* unique) const;
 
   void report() const;
   void setDesign(frDesign* design) { design_ = design; }
@@ -103,6 +106,9 @@ class UniqueInsts
   std::map<frInst*, int, frBlockObjectComp> unique2paidx_;
   // Maps a unique instance to its index in unique_
   std::map<frInst*, int, frBlockObjectComp> unique2Idx_;
+  // Maps a unique instance to the track offsets of its class
+  std::map<frInst*, const std::vector<frCoord>*, frBlockObjectComp>
+      unique2offsets_;
   // master orient track-offset to instances
   std::map<frMaster*,
            std::map<dbOrientType, std::map<std::vector<frCoord>, InstSet>>,
@@ -28,7 +28,8 @@ def detailed_route(design, *,
                    no_pin_access=False,
                    single_step_dr=False,
                    min_access_points=-1,
-                   save_guide_updates=False):
+                   save_guide_updates=False,
+                   pin_access_cache_dir=""):
 
     router = design.getTritonRoute()
     params = drt.ParamStruct()
@@ -51,6 +52,7 @@ def detailed_route(design, *,
     params.singleStepDR = single_step_dr
     params.minAccessPoints = min_access_points
     params.saveGuideUpdates = save_guide_updates
+    params.pinAccessCacheDir = pin_access_cache_dir
 
     router.setParams(params)
     router.main()
@@ -0,0 +1,47 @@
+# pin access cache reuse and invalidation
+source "helpers.tcl"
+read_lef testcase/ispd18_sample/ispd18_sample.input.lef
+read_def testcase/ispd18_sample/ispd18_sample.input.def
+
+proc get_access_points {} {
+  set aps {}
+  foreach inst [[ord::get_db_block] getInsts] {
+    foreach iterm [$inst getITerms] {
+      foreach ap [$iterm getPrefAccessPoints] {
+        lappend aps [list [$inst getName] [[$iterm getMTerm] getName] \
+                       [$ap getPoint] [[$ap getLayer] getName]]
+      }
+    }
+  }
+  return $aps
+}
+
+proc get_cache_files { cache_dir } {
+  return [lsort [glob -nocomplain -directory $cache_dir pa_*.bin]]
+}
+
+set cache_dir [make_result_file pin_access_cache]
+file delete -force $cache_dir
+file mkdir $cache_dir
+
+# The first run computes the access points and fills the cache.
+pin_access -pin_access_cache_dir $cache_dir -verbose 0
+set cold_aps [get_access_points]
+set cache_files [get_cache_files $cache_dir]
+puts "Cache files after first run: [llength $cache_files]"
+file stat [lindex $cache_files 0] cache_stat
+
+# The second run finds every class in the cache, so it has nothing new to
+# save and must leave the cache file untouched.
+pin_access -pin_access_cache_dir $cache_dir -verbose 0
+set warm_aps [get_access_points]
+file stat [lindex $cache_files 0] warm_stat
+puts "Cache files after second run: [llength [get_cache_files $cache_dir]]"
+puts "Cache file rewritten: [expr $cache_stat(ino) != $warm_stat(ino)]"
+puts "Access points match: [expr {$cold_aps eq $warm_aps}]"
+
+# A rule change must not reuse the access points computed for the old rules.
+set layer [[ord::get_db_tech] findLayer Metal1]
+$layer setSpacing [expr [$layer getSpacing] + 10]
+pin_access -pin_access_cache_dir $cache_dir -verbose 0
+puts "Cache files after rule change: [llength [get_cache_files $cache_dir]]"
@@ -4,6 +4,7 @@ record_tests {
   ndr_vias1
   ndr_vias2
   obstruction
+  pin_access_cache
   single_step
   ta_ap_aligned
   ta_pin_aligned
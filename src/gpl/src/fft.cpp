@@ -136,20 +136,20 @@ void FFT::doFFT()
          (int*) &workArea_[0],
          (float*) &csTable_[0]);
 
+  // The ddct2d/ddsct2d twiddle tables (csTable_, workArea_) are built on
+  // the first call only; the per-bin passes below are independent.
+#pragma omp parallel for num_threads(num_threads_)
   for (int i = 0; i < binCntX_; i++) {
     binDensity_[i][0] *= 0.5;
-  }
-
-  for (int i = 0; i < binCntY_; i++) {
-    binDensity_[0][i] *= 0.5;
-  }
-
-  for (int i = 0; i < binCntX_; i++) {
     for (int j = 0; j < binCntY_; j++) {
+      if (i == 0) {
+        binDensity_[i][j] *= 0.5;
+      }
       binDensity_[i][j] *= 4.0 / binCntX_ / binCntY_;
     }
   }
 
+#pragma omp parallel for num_threads(num_threads_)
   for (int i = 0; i < binCntX_; i++) {
     float wx = wx_[i];
     float wx2 = wxSquare_[i];
@@ -43,6 +43,8 @@ class FFT
   FFT(int binCntX, int binCntY, int binSizeX, int binSizeY);
   ~FFT();
 
+  void setNumThreads(int num_threads) { num_threads_ = num_threads; }
+
   // input func
   void updateDensity(int x, int y, float density);
 
@@ -81,6 +83,7 @@ class FFT
   int binCntY_ = 0;
   int binSizeX_ = 0;
   int binSizeY_ = 0;
+  int num_threads_ = 1;
 };
 
 //
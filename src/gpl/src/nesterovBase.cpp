@@ -727,61 +727,90 @@ void BinGrid::updateBinsNonPlaceArea()
 void BinGrid::updateBinsGCellDensityArea(const std::vector<GCell*>& cells)
 {
   // clear the Bin-area info
-  for (Bin& bin : bins_) {
+#pragma omp parallel for num_threads(num_threads_)
+  for (auto it = bins_.begin(); it < bins_.end(); ++it) {
+    Bin& bin = *it;  // old-style loop for old OpenMP
     bin.setInstPlacedAreaUnscaled(0);
     bin.setFillerArea(0);
   }
 
-  for (auto& cell : cells) {
-    std::pair<int, int> pairX = getDensityMinMaxIdxX(cell);
-    std::pair<int, int> pairY = getDensityMinMaxIdxY(cell);
-
-    // The following function is critical runtime hotspot
-    // for global placer.
-    //
-    if (cell->isInstance()) {
-      // macro should have
-      // scale-down with target-density
-      if (cell->isMacroInstance()) {
-        for (int y = pairY.first; y < pairY.second; y++) {
-          for (int x = pairX.first; x < pairX.second; x++) {
-            Bin& bin = bins_[y * binCntX_ + x];
+  // The bin index ranges only depend on the cell location, so they are
+  // computed once up front instead of once per row band below.
+  const int numCells = cells.size();
+  std::vector<std::pair<int, int>> rangeX(numCells);
+  std::vector<std::pair<int, int>> rangeY(numCells);
+#pragma omp parallel for num_threads(num_threads_)
+  for (int i = 0; i < numCells; i++) {
+    rangeX[i] = getDensityMinMaxIdxX(cells[i]);
+    rangeY[i] = getDensityMinMaxIdxY(cells[i]);
+  }
 
-            const float scaledAvea = getOverlapDensityArea(bin, cell)
-                                     * cell->densityScale()
-                                     * bin.targetDensity();
-            bin.addInstPlacedAreaUnscaled(scaledAvea);
+  // The following loop is critical runtime hotspot
+  // for global placer.
+  //
+  // Every thread owns a contiguous band of bin rows and walks the cells
+  // in their original order, only touching the rows of its band. No two
+  // threads write the same bin and each bin accumulates its overlaps in
+  // the same order as a serial pass, so the areas are bit-identical
+  // regardless of the thread count.
+  const int numBands = std::max(1, std::min(num_threads_, binCntY_));
+#pragma omp parallel for num_threads(numBands) schedule(static, 1)
+  for (int band = 0; band < numBands; band++) {
+    const int bandLy = static_cast<int>(
+        static_cast<int64_t>(binCntY_) * band / numBands);
+    const int bandUy = static_cast<int>(
+        static_cast<int64_t>(binCntY_) * (band + 1) / numBands);
+
+    for (int i = 0; i < numCells; i++) {
+      const int minY = std::max(rangeY[i].first, bandLy);
+      const int maxY = std::min(rangeY[i].second, bandUy);
+      if (minY >= maxY) {
+        continue;
+      }
+      GCell* cell = cells[i];
+      const std::pair<int, int>& pairX = rangeX[i];
+
+      if (cell->isInstance()) {
+        // macro should have
+        // scale-down with target-density
+        if (cell->isMacroInstance()) {
+          for (int y = minY; y < maxY; y++) {
+            for (int x = pairX.first; x < pairX.second; x++) {
+              Bin& bin = bins_[y * binCntX_ + x];
+
+              const float scaledAvea = getOverlapDensityArea(bin, cell)
+                                       * cell->densityScale()
+                                       * bin.targetDensity();
+              bin.addInstPlacedAreaUnscaled(scaledAvea);
+            }
           }
         }
-      }
-      // normal cells
-      else if (cell->isStdInstance()) {
-        for (int y = pairY.first; y < pairY.second; y++) {
+        // normal cells
+        else if (cell->isStdInstance()) {
+          for (int y = minY; y < maxY; y++) {
+            for (int x = pairX.first; x < pairX.second; x++) {
+              Bin& bin = bins_[y * binCntX_ + x];
+              const float scaledArea
+                  = getOverlapDensityArea(bin, cell) * cell->densityScale();
+              bin.addInstPlacedAreaUnscaled(scaledArea);
+            }
+          }
+        }
+      } else if (cell->isFiller()) {
+        for (int y = minY; y < maxY; y++) {
           for (int x = pairX.first; x < pairX.second; x++) {
             Bin& bin = bins_[y * binCntX_ + x];
-            const float scaledArea
-                = getOverlapDensityArea(bin, cell) * cell->densityScale();
-            bin.addInstPlacedAreaUnscaled(scaledArea);
+            bin.addFillerArea(getOverlapDensityArea(bin, cell)
+                              * cell->densityScale());
           }
         }
       }
-    } else if (cell->isFiller()) {
-      for (int y = pairY.first; y < pairY.second; y++) {
-        for (int x = pairX.first; x < pairX.second; x++) {
-          Bin& bin = bins_[y * binCntX_ + x];
-          bin.addFillerArea(getOverlapDensityArea(bin, cell)
-                            * cell->densityScale());
-        }
-      }
     }
   }
 
-  overflowArea_ = 0;
-  overflowAreaUnscaled_ = 0;
-  // update density and overflowArea
+  // update density
   // for nesterov use and FFT library
-#pragma omp parallel for num_threads(num_threads_) \
-    reduction(+ : overflowArea_, overflowAreaUnscaled_)
+#pragma omp parallel for num_threads(num_threads_)
   for (auto it = bins_.begin(); it < bins_.end(); ++it) {
     Bin& bin = *it;  // old-style loop for old OpenMP
 
@@ -795,6 +824,17 @@ void BinGrid::updateBinsGCellDensityArea(const std::vector<GCell*>& cells)
                     + static_cast<float>(bin.fillerArea())
                     + static_cast<float>(bin.nonPlaceArea()))
                    / scaledBinArea);
+  }
+
+  // update overflowArea
+  // Kept serial: each step rounds the running sum through float, so
+  // per-thread partial sums would make the overflow, and with it the
+  // convergence and timing-driven triggers, depend on the thread count.
+  overflowArea_ = 0;
+  overflowAreaUnscaled_ = 0;
+  for (const Bin& bin : bins_) {
+    const float scaledBinArea
+        = static_cast<float>(bin.binArea() * bin.targetDensity());
 
     overflowArea_ += std::max(0.0f,
                               static_cast<float>(bin.instPlacedArea())
@@ -1019,6 +1059,9 @@ void NesterovBaseCommon::updateWireLengthForceWA(float wlCoeffX, float wlCoeffY)
     gPin->clearWaVars();
   }
 
+  const float forceBar = nbVars_.minWireLengthForceBar;
+  const bool debug = log_->debugCheck(GPL, "wlUpdateWA", 1);
+
 #pragma omp parallel for num_threads(num_threads_)
   for (auto gNet = gNetStor_.begin(); gNet < gNetStor_.end(); ++gNet) {
     // old-style loop for old OpenMP
@@ -1026,7 +1069,22 @@ void NesterovBaseCommon::updateWireLengthForceWA(float wlCoeffX, float wlCoeffY)
     gNet->clearWaVars();
     gNet->updateBox();
 
+    const int netLx = gNet->lx();
+    const int netLy = gNet->ly();
+    const int netUx = gNet->ux();
+    const int netUy = gNet->uy();
+
+    // The net sums are accumulated in registers in pin order and stored
+    // once, rather than read-modify-written through the GNet per pin.
+    float waExpMinSumX = 0, waXExpMinSumX = 0;
+    float waExpMaxSumX = 0, waXExpMaxSumX = 0;
+    float waExpMinSumY = 0, waYExpMinSumY = 0;
+    float waExpMaxSumY = 0, waYExpMaxSumY = 0;
+
     for (auto& gPin : gNet->gPins()) {
+      const int cx = gPin->cx();
+      const int cy = gPin->cy();
+
       // The WA terms are shift invariant:
       //
       //   Sum(x_i * exp(x_i))    Sum(x_i * exp(x_i - C))
@@ -1034,75 +1092,84 @@ void NesterovBaseCommon::updateWireLengthForceWA(float wlCoeffX, float wlCoeffY)
       //   Sum(exp(x_i))          Sum(exp(x_i - C))
       //
       // So we shift to keep the exponential from overflowing
-      float expMinX = (gNet->lx() - gPin->cx()) * wlCoeffX;
-      float expMaxX = (gPin->cx() - gNet->ux()) * wlCoeffX;
-      float expMinY = (gNet->ly() - gPin->cy()) * wlCoeffY;
-      float expMaxY = (gPin->cy() - gNet->uy()) * wlCoeffY;
+      const float expMinX = (netLx - cx) * wlCoeffX;
+      const float expMaxX = (cx - netUx) * wlCoeffX;
+      const float expMinY = (netLy - cy) * wlCoeffY;
+      const float expMaxY = (cy - netUy) * wlCoeffY;
 
       // min x
-      if (expMinX > nbVars_.minWireLengthForceBar) {
-        gPin->setMinExpSumX(fastExp(expMinX));
-        gNet->addWaExpMinSumX(gPin->minExpSumX());
-        gNet->addWaXExpMinSumX(gPin->cx() * gPin->minExpSumX());
-        if (gPin->gCell() && gPin->gCell()->isInstance()) {
-          debugPrint(log_,
-                     GPL,
-                     "wlUpdateWA",
-                     1,
-                     "MinX updated: {} {:g}",
-                     gPin->gCell()->instance()->dbInst()->getConstName(),
-                     gPin->minExpSumX());
-        }
+      if (expMinX > forceBar) {
+        const float minExpSumX = fastExp(expMinX);
+        gPin->setMinExpSumX(minExpSumX);
+        waExpMinSumX += minExpSumX;
+        waXExpMinSumX += cx * minExpSumX;
       }
 
       // max x
-      if (expMaxX > nbVars_.minWireLengthForceBar) {
-        gPin->setMaxExpSumX(fastExp(expMaxX));
-        gNet->addWaExpMaxSumX(gPin->maxExpSumX());
-        gNet->addWaXExpMaxSumX(gPin->cx() * gPin->maxExpSumX());
-        if (gPin->gCell() && gPin->gCell()->isInstance()) {
-          debugPrint(log_,
-                     GPL,
-                     "wlUpdateWA",
-                     1,
-                     "MaxX updated: {} {:g}",
-                     gPin->gCell()->instance()->dbInst()->getConstName(),
-                     gPin->maxExpSumX());
-        }
+      if (expMaxX > forceBar) {
+        const float maxExpSumX = fastExp(expMaxX);
+        gPin->setMaxExpSumX(maxExpSumX);
+        waExpMaxSumX += maxExpSumX;
+        waXExpMaxSumX += cx * maxExpSumX;
       }
 
       // min y
-      if (expMinY > nbVars_.minWireLengthForceBar) {
-        gPin->setMinExpSumY(fastExp(expMinY));
-        gNet->addWaExpMinSumY(gPin->minExpSumY());
-        gNet->addWaYExpMinSumY(gPin->cy() * gPin->minExpSumY());
-        if (gPin->gCell() && gPin->gCell()->isInstance()) {
-          debugPrint(log_,
-                     GPL,
-                     "wlUpdateWA",
-                     1,
-                     "MinY updated: {} {:g}",
-                     gPin->gCell()->instance()->dbInst()->getConstName(),
-                     gPin->minExpSumY());
-        }
+      if (expMinY > forceBar) {
+        const float minExpSumY = fastExp(expMinY);
+        gPin->setMinExpSumY(minExpSumY);
+        waExpMinSumY += minExpSumY;
+        waYExpMinSumY += cy * minExpSumY;
       }
 
       // max y
-      if (expMaxY > nbVars_.minWireLengthForceBar) {
-        gPin->setMaxExpSumY(fastExp(expMaxY));
-        gNet->addWaExpMaxSumY(gPin->maxExpSumY());
-        gNet->addWaYExpMaxSumY(gPin->cy() * gPin->maxExpSumY());
-        if (gPin->gCell() && gPin->gCell()->isInstance()) {
-          debugPrint(log_,
-                     GPL,
-                     "wlUpdateWA",
-                     1,
-                     "MaxY updated: {} {:g}",
-                     gPin->gCell()->instance()->dbInst()->getConstName(),
-                     gPin->maxExpSumY());
+      if (expMaxY > forceBar) {
+        const float maxExpSumY = fastExp(expMaxY);
+        gPin->setMaxExpSumY(maxExpSumY);
+        waExpMaxSumY += maxExpSumY;
+        waYExpMaxSumY += cy * maxExpSumY;
+      }
+
+      if (debug && gPin->gCell() && gPin->gCell()->isInstance()) {
+        const char* name = gPin->gCell()->instance()->dbInst()->getConstName();
+        if (expMinX > forceBar) {
+          log_->debug(GPL,
+                      "wlUpdateWA",
+                      "MinX updated: {} {:g}",
+                      name,
+                      gPin->minExpSumX());
+        }
+        if (expMaxX > forceBar) {
+          log_->debug(GPL,
+                      "wlUpdateWA",
+                      "MaxX updated: {} {:g}",
+                      name,
+                      gPin->maxExpSumX());
+        }
+        if (expMinY > forceBar) {
+          log_->debug(GPL,
+                      "wlUpdateWA",
+                      "MinY updated: {} {:g}",
+                      name,
+                      gPin->minExpSumY());
+        }
+        if (expMaxY > forceBar) {
+          log_->debug(GPL,
+                      "wlUpdateWA",
+                      "MaxY updated: {} {:g}",
+                      name,
+                      gPin->maxExpSumY());
         }
       }
     }
+
+    gNet->addWaExpMinSumX(waExpMinSumX);
+    gNet->addWaXExpMinSumX(waXExpMinSumX);
+    gNet->addWaExpMaxSumX(waExpMaxSumX);
+    gNet->addWaXExpMaxSumX(waXExpMaxSumX);
+    gNet->addWaExpMinSumY(waExpMinSumY);
+    gNet->addWaYExpMinSumY(waYExpMinSumY);
+    gNet->addWaExpMaxSumY(waExpMaxSumY);
+    gNet->addWaYExpMaxSumY(waYExpMaxSumY);
   }
 }
 
@@ -1324,6 +1391,7 @@ NesterovBase::NesterovBase(NesterovBaseVars nbVars,
   bg_.setLogger(log_);
   bg_.setCorePoints(&(pb_->die()));
   bg_.setTargetDensity(targetDensity_);
+  bg_.setNumThreads(nbc_->getNumThreads());
 
   // update binGrid info
   bg_.initBins();
@@ -1331,6 +1399,7 @@ NesterovBase::NesterovBase(NesterovBaseVars nbVars,
   // initialize fft structrue based on bins
   std::unique_ptr<FFT> fft(
       new FFT(bg_.binCntX(), bg_.binCntY(), bg_.binSizeX(), bg_.binSizeY()));
+  fft->setNumThreads(nbc_->getNumThreads());
 
   fft_ = std::move(fft);
 
@@ -0,0 +1,44 @@
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "src/gpl/src/nesterovBase.h"
+
+namespace {
+
+// Overflow summed over bins whose areas are large enough for the float
+// accumulation to round, with the given number of threads.
+std::pair<int64_t, int64_t> binOverflow(int num_threads)
+{
+  const int bin_cnt = 64;
+  const int bin_size = 1000;
+
+  gpl::BinGrid grid;
+  grid.setNumThreads(num_threads);
+  for (int y = 0; y < bin_cnt; y++) {
+    for (int x = 0; x < bin_cnt; x++) {
+      const int lx = x * bin_size;
+      const int ly = y * bin_size;
+      gpl::Bin bin(x, y, lx, ly, lx + bin_size, ly + bin_size, 0.7);
+      const int64_t area = 500000 + (x * 7919 + y * 104729) % 900001;
+      bin.setNonPlaceArea(area);
+      bin.setNonPlaceAreaUnscaled(area);
+      grid.bins().push_back(bin);
+    }
+  }
+  grid.updateBinsGCellDensityArea({});
+
+  return {grid.overflowArea(), grid.overflowAreaUnscaled()};
+}
+
+TEST(BinGridTest, OverflowIndependentOfThreadCount)
+{
+  const std::pair<int64_t, int64_t> serial = binOverflow(1);
+  EXPECT_GT(serial.first, 0);
+  for (int num_threads : {2, 4, 8}) {
+    EXPECT_EQ(binOverflow(num_threads), serial) << num_threads << " threads";
+  }
+}
+
+}  // namespace
@@ -175,6 +175,7 @@ class GlobalRouter : public ant::GlobalRouteSource
   void setVerbose(const bool v);
   void setOverflowIterations(int iterations);
   void setCongestionReportIterStep(int congestion_report_iter_step);
+  void setNumThreads(int num_threads);
   void setCongestionReportFile(const char* file_name);
   void setGridOrigin(int x, int y);
   void setAllowCongestion(bool allow_congestion);
@@ -452,6 +453,7 @@ class GlobalRouter : public ant::GlobalRouteSource
   int gcells_offset_;
   int overflow_iterations_;
   int congestion_report_iter_step_;
+  int num_threads_;
   bool allow_congestion_;
   std::vector<int> vertical_capacities_;
   std::vector<int> horizontal_capacities_;
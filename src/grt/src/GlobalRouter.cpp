@@ -95,6 +95,7 @@ GlobalRouter::GlobalRouter()
       gcells_offset_(2),
       overflow_iterations_(50),
       congestion_report_iter_step_(0),
+      num_threads_(1),
       allow_congestion_(false),
       macro_extension_(0),
       initialized_(false),
@@ -1556,6 +1557,11 @@ void GlobalRouter::setCongestionReportIterStep(int congestion_report_iter_step)
   congestion_report_iter_step_ = congestion_report_iter_step;
 }
 
+void GlobalRouter::setNumThreads(int num_threads)
+{
+  num_threads_ = num_threads;
+}
+
 void GlobalRouter::setCongestionReportFile(const char* file_name)
 {
   congestion_file_name_ = file_name;
@@ -1669,6 +1675,7 @@ void GlobalRouter::configFastRoute()
   fastroute_->setVerbose(verbose_);
   fastroute_->setOverflowIterations(overflow_iterations_);
   fastroute_->setCongestionReportIterStep(congestion_report_iter_step_);
+  fastroute_->setNumThreads(num_threads_);
 
   if (congestion_file_name_ != nullptr) {
     fastroute_->setCongestionReportFile(congestion_file_name_);
@@ -194,6 +194,7 @@ set_perturbation_amount(int perturbation)
 void
 global_route(bool start_incremental, bool end_incremental)
 {
+  getGlobalRouter()->setNumThreads(ord::OpenRoad::openRoad()->getThreadCount());
   getGlobalRouter()->globalRoute(true, start_incremental, end_incremental);
 }
 
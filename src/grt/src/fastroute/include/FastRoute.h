@@ -189,6 +189,7 @@ class FastRouteCore
   void setMakeWireParasiticsBuilder(AbstractMakeWireParasitics* builder);
   void setOverflowIterations(int iterations);
   void setCongestionReportIterStep(int congestion_report_iter_step);
+  void setNumThreads(int num_threads);
   void setCongestionReportFile(const char* congestion_file_name);
   void setGridMax(int x_max, int y_max);
   void getCongestionNets(std::set<odb::dbNet*>& congestion_nets);
@@ -533,6 +534,7 @@ class FastRouteCore
   odb::dbDatabase* db_;
   int overflow_iterations_;
   int congestion_report_iter_step_;
+  int num_threads_;
   std::string congestion_file_name_;
   std::vector<odb::dbTechLayerDir> layer_directions_;
   int x_range_;
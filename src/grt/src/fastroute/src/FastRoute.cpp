@@ -55,6 +55,7 @@ FastRouteCore::FastRouteCore(odb::dbDatabase* db,
       db_(db),
       overflow_iterations_(0),
       congestion_report_iter_step_(0),
+      num_threads_(1),
       x_range_(0),
       y_range_(0),
       num_adjust_(0),
@@ -1399,6 +1400,11 @@ void FastRouteCore::setCongestionReportIterStep(int congestion_report_iter_step)
   congestion_report_iter_step_ = congestion_report_iter_step;
 }
 
+void FastRouteCore::setNumThreads(int num_threads)
+{
+  num_threads_ = num_threads;
+}
+
 void FastRouteCore::setCongestionReportFile(const char* congestion_file_name)
 {
   congestion_file_name_ = congestion_file_name;
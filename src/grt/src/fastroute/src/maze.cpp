@@ -520,7 +520,11 @@ void FastRouteCore::convertToMazeroute()
 }
 
 // non recursive version of heapify
-static void heapify(std::vector<float*>& array)
+// heap_index maps every entry (by its offset from base) to its current
+// position in the heap so updates don't have to search for it.
+static void heapify(std::vector<float*>& array,
+                    const float* base,
+                    std::vector<int>& heap_index)
 {
   bool stop = false;
   const int heapSize = array.size();
@@ -543,30 +547,39 @@ static void heapify(std::vector<float*>& array)
     }
     if (smallest != i) {
       array[i] = array[smallest];
+      heap_index[array[i] - base] = i;
       i = smallest;
     } else {
       array[i] = tmp;
+      heap_index[tmp - base] = i;
       stop = true;
     }
   } while (!stop);
 }
 
-static void updateHeap(std::vector<float*>& array, int i)
+static void updateHeap(std::vector<float*>& array,
+                       int i,
+                       const float* base,
+                       std::vector<int>& heap_index)
 {
   float* tmpi = array[i];
   while (i > 0 && *(array[parent_index(i)]) > *tmpi) {
     const int parent = parent_index(i);
     array[i] = array[parent];
+    heap_index[array[i] - base] = i;
     i = parent;
   }
   array[i] = tmpi;
+  heap_index[tmpi - base] = i;
 }
 
 // remove the entry with minimum distance from Priority queue
-static void removeMin(std::vector<float*>& array)
+static void removeMin(std::vector<float*>& array,
+                      const float* base,
+                      std::vector<int>& heap_index)
 {
   array[0] = array.back();
-  heapify(array);
+  heapify(array, base, heap_index);
   array.pop_back();
 }
 
@@ -1355,6 +1368,8 @@ void FastRouteCore::mazeRouteMSMD(const int iter,
   multi_array<float, 2> d2(boost::extents[y_range_][x_range_]);
 
   std::vector<bool> pop_heap2(y_grid_ * x_range_, false);
+  std::vector<int> heap_index(y_range_ * x_range_);
+  const float* d1_base = &d1[0][0];
 
   for (int nidRPC = 0; nidRPC < net_ids_.size(); nidRPC++) {
     const int netID
@@ -1444,6 +1459,10 @@ void FastRouteCore::mazeRouteMSMD(const int iter,
                 regionY1,
                 regionY2);
 
+      for (int i = 0; i < src_heap.size(); i++) {
+        heap_index[src_heap[i] - d1_base] = i;
+      }
+
       // while loop to find shortest path
       int ind1 = (src_heap[0] - &d1[0][0]);
       for (int i = 0; i < dest_heap.size(); i++)
@@ -1470,7 +1489,7 @@ void FastRouteCore::mazeRouteMSMD(const int iter,
           preY = curY;
         }
 
-        removeMin(src_heap);
+        removeMin(src_heap, d1_base, heap_index);
 
         // left
         if (curX > regionX1) {
@@ -1519,7 +1538,8 @@ void FastRouteCore::mazeRouteMSMD(const int iter,
             parent_y3_[curY][tmpX] = curY;
             hv_[curY][tmpX] = false;
             src_heap.push_back(&d1[curY][tmpX]);
-            updateHeap(src_heap, src_heap.size() - 1);
+            updateHeap(
+                src_heap, src_heap.size() - 1, d1_base, heap_index);
           } else if (d1[curY][tmpX] > tmp)  // left neighbor been put into
                                             // src_heap but needs update
           {
@@ -1527,11 +1547,10 @@ void FastRouteCore::mazeRouteMSMD(const int iter,
             parent_x3_[curY][tmpX] = curX;
             parent_y3_[curY][tmpX] = curY;
             hv_[curY][tmpX] = false;
-            float* dtmp = &d1[curY][tmpX];
-            int ind = 0;
-            while (src_heap[ind] != dtmp)
-              ind++;
-            updateHeap(src_heap, ind);
+            updateHeap(src_heap,
+                       heap_index[&d1[curY][tmpX] - d1_base],
+                       d1_base,
+                       heap_index);
           }
         }
         // right
@@ -1580,7 +1599,8 @@ void FastRouteCore::mazeRouteMSMD(const int iter,
             parent_y3_[curY][tmpX] = curY;
             hv_[curY][tmpX] = false;
             src_heap.push_back(&d1[curY][tmpX]);
-            updateHeap(src_heap, src_heap.size() - 1);
+            updateHeap(
+                src_heap, src_heap.size() - 1, d1_base, heap_index);
           } else if (d1[curY][tmpX] > tmp)  // right neighbor been put into
                                             // src_heap but needs update
           {
@@ -1588,11 +1608,10 @@ void FastRouteCore::mazeRouteMSMD(const int iter,
             parent_x3_[curY][tmpX] = curX;
             parent_y3_[curY][tmpX] = curY;
             hv_[curY][tmpX] = false;
-            float* dtmp = &d1[curY][tmpX];
-            int ind = 0;
-            while (src_heap[ind] != dtmp)
-              ind++;
-            updateHeap(src_heap, ind);
+            updateHeap(src_heap,
+                       heap_index[&d1[curY][tmpX] - d1_base],
+                       d1_base,
+                       heap_index);
           }
         }
         // bottom
@@ -1640,7 +1659,8 @@ void FastRouteCore::mazeRouteMSMD(const int iter,
             parent_y1_[tmpY][curX] = curY;
             hv_[tmpY][curX] = true;
             src_heap.push_back(&d1[tmpY][curX]);
-            updateHeap(src_heap, src_heap.size() - 1);
+            updateHeap(
+                src_heap, src_heap.size() - 1, d1_base, heap_index);
           } else if (d1[tmpY][curX] > tmp)  // bottom neighbor been put into
                                             // src_heap but needs update
           {
@@ -1648,11 +1668,10 @@ void FastRouteCore::mazeRouteMSMD(const int iter,
             parent_x1_[tmpY][curX] = curX;
             parent_y1_[tmpY][curX] = curY;
             hv_[tmpY][curX] = true;
-            float* dtmp = &d1[tmpY][curX];
-            int ind = 0;
-            while (src_heap[ind] != dtmp)
-              ind++;
-            updateHeap(src_heap, ind);
+            updateHeap(src_heap,
+                       heap_index[&d1[tmpY][curX] - d1_base],
+                       d1_base,
+                       heap_index);
           }
         }
         // top
@@ -1701,7 +1720,8 @@ void FastRouteCore::mazeRouteMSMD(const int iter,
             parent_y1_[tmpY][curX] = curY;
             hv_[tmpY][curX] = true;
             src_heap.push_back(&d1[tmpY][curX]);
-            updateHeap(src_heap, src_heap.size() - 1);
+            updateHeap(
+                src_heap, src_heap.size() - 1, d1_base, heap_index);
           } else if (d1[tmpY][curX] > tmp)  // top neighbor been put into
                                             // src_heap but needs update
           {
@@ -1709,11 +1729,10 @@ void FastRouteCore::mazeRouteMSMD(const int iter,
             parent_x1_[tmpY][curX] = curX;
             parent_y1_[tmpY][curX] = curY;
             hv_[tmpY][curX] = true;
-            float* dtmp = &d1[tmpY][curX];
-            int ind = 0;
-            while (src_heap[ind] != dtmp)
-              ind++;
-            updateHeap(src_heap, ind);
+            updateHeap(src_heap,
+                       heap_index[&d1[tmpY][curX] - d1_base],
+                       d1_base,
+                       heap_index);
           }
         }
 
@@ -63,7 +63,11 @@ static int right_index(int i)
 }
 
 // non recursive version of heapify-
-static void heapify3D(std::vector<int*>& array)
+// heap_index maps every entry (by its offset from base) to its current
+// position in the heap so updates don't have to search for it.
+static void heapify3D(std::vector<int*>& array,
+                      const int* base,
+                      std::vector<int>& heap_index)
 {
   bool stop = false;
   const int heapSize = array.size();
@@ -86,30 +90,39 @@ static void heapify3D(std::vector<int*>& array)
     }
     if (smallest != i) {
       array[i] = array[smallest];
+      heap_index[array[i] - base] = i;
       i = smallest;
     } else {
       array[i] = tmp;
+      heap_index[tmp - base] = i;
       stop = true;
     }
   } while (!stop);
 }
 
-static void updateHeap3D(std::vector<int*>& array, int i)
+static void updateHeap3D(std::vector<int*>& array,
+                         int i,
+                         const int* base,
+                         std::vector<int>& heap_index)
 {
   int* tmpi = array[i];
   while (i > 0 && *(array[parent_index(i)]) > *tmpi) {
     const int parent = parent_index(i);
     array[i] = array[parent];
+    heap_index[array[i] - base] = i;
     i = parent;
   }
   array[i] = tmpi;
+  heap_index[tmpi - base] = i;
 }
 
 // extract the entry with minimum distance from Priority queue
-static void removeMin3D(std::vector<int*>& array)
+static void removeMin3D(std::vector<int*>& array,
+                        const int* base,
+                        std::vector<int>& heap_index)
 {
   array[0] = array.back();
-  heapify3D(array);
+  heapify3D(array, base, heap_index);
   array.pop_back();
 }
 
@@ -814,6 +827,9 @@ void FastRouteCore::mazeRouteMSMDOrder3D(int expand,
   static multi_array<int, 3> d2_3D(
       boost::extents[num_layers_][y_range_][x_range_]);
 
+  std::vector<int> heap_index(d1_3D.num_elements());
+  const int* d1_base = &d1_3D[0][0][0];
+
   for (int orderIndex = 0; orderIndex < endIND; orderIndex++) {
     const int netID = tree_order_pv_[orderIndex].treeIndex;
 
@@ -887,6 +903,10 @@ void FastRouteCore::mazeRouteMSMDOrder3D(int expand,
                   regionY1,
                   regionY2);
 
+      for (int i = 0; i < src_heap_3D.size(); i++) {
+        heap_index[src_heap_3D[i] - d1_base] = i;
+      }
+
       // while loop to find shortest path
       int ind1 = (src_heap_3D[0] - &d1_3D[0][0][0]);
 
@@ -903,7 +923,7 @@ void FastRouteCore::mazeRouteMSMDOrder3D(int expand,
         const int remd = ind1 % (grid_hv_);
         const int curX = remd % x_range_;
         const int curY = remd / x_range_;
-        removeMin3D(src_heap_3D);
+        removeMin3D(src_heap_3D, d1_base, heap_index);
 
         const bool Horizontal
             = layer_directions_[curL] == odb::dbTechLayerDir::HORIZONTAL;
@@ -927,7 +947,8 @@ void FastRouteCore::mazeRouteMSMDOrder3D(int expand,
                 pr_3D_[curL][curY][tmpX].y = curY;
                 directions_3D[curL][curY][tmpX] = Direction::West;
                 src_heap_3D.push_back(&d1_3D[curL][curY][tmpX]);
-                updateHeap3D(src_heap_3D, src_heap_3D.size() - 1);
+                updateHeap3D(
+                    src_heap_3D, src_heap_3D.size() - 1, d1_base, heap_index);
               } else if (d1_3D[curL][curY][tmpX]
                          > tmp)  // left neighbor been put into src_heap_3D
                                  // but needs update
@@ -937,11 +958,10 @@ void FastRouteCore::mazeRouteMSMDOrder3D(int expand,
                 pr_3D_[curL][curY][tmpX].x = curX;
                 pr_3D_[curL][curY][tmpX].y = curY;
                 directions_3D[curL][curY][tmpX] = Direction::West;
-                const int* dtmp = &d1_3D[curL][curY][tmpX];
-                int ind = 0;
-                while (src_heap_3D[ind] != dtmp)
-                  ind++;
-                updateHeap3D(src_heap_3D, ind);
+                updateHeap3D(src_heap_3D,
+                             heap_index[&d1_3D[curL][curY][tmpX] - d1_base],
+                             d1_base,
+                             heap_index);
               }
             }
           }
@@ -964,7 +984,8 @@ void FastRouteCore::mazeRouteMSMDOrder3D(int expand,
                 pr_3D_[curL][curY][tmpX].y = curY;
                 directions_3D[curL][curY][tmpX] = Direction::East;
                 src_heap_3D.push_back(&d1_3D[curL][curY][tmpX]);
-                updateHeap3D(src_heap_3D, src_heap_3D.size() - 1);
+                updateHeap3D(
+                    src_heap_3D, src_heap_3D.size() - 1, d1_base, heap_index);
               } else if (d1_3D[curL][curY][tmpX]
                          > tmp)  // right neighbor been put into src_heap_3D
                                  // but needs update
@@ -974,11 +995,10 @@ void FastRouteCore::mazeRouteMSMDOrder3D(int expand,
                 pr_3D_[curL][curY][tmpX].x = curX;
                 pr_3D_[curL][curY][tmpX].y = curY;
                 directions_3D[curL][curY][tmpX] = Direction::East;
-                const int* dtmp = &d1_3D[curL][curY][tmpX];
-                int ind = 0;
-                while (src_heap_3D[ind] != dtmp)
-                  ind++;
-                updateHeap3D(src_heap_3D, ind);
+                updateHeap3D(src_heap_3D,
+                             heap_index[&d1_3D[curL][curY][tmpX] - d1_base],
+                             d1_base,
+                             heap_index);
               }
             }
           }
@@ -1001,7 +1021,8 @@ void FastRouteCore::mazeRouteMSMDOrder3D(int expand,
                 pr_3D_[curL][tmpY][curX].y = curY;
                 directions_3D[curL][tmpY][curX] = Direction::North;
                 src_heap_3D.push_back(&d1_3D[curL][tmpY][curX]);
-                updateHeap3D(src_heap_3D, src_heap_3D.size() - 1);
+                updateHeap3D(
+                    src_heap_3D, src_heap_3D.size() - 1, d1_base, heap_index);
               } else if (d1_3D[curL][tmpY][curX]
                          > tmp)  // bottom neighbor been put into
                                  // src_heap_3D but needs update
@@ -1011,11 +1032,10 @@ void FastRouteCore::mazeRouteMSMDOrder3D(int expand,
                 pr_3D_[curL][tmpY][curX].x = curX;
                 pr_3D_[curL][tmpY][curX].y = curY;
                 directions_3D[curL][tmpY][curX] = Direction::North;
-                const int* dtmp = &d1_3D[curL][tmpY][curX];
-                int ind = 0;
-                while (src_heap_3D[ind] != dtmp)
-                  ind++;
-                updateHeap3D(src_heap_3D, ind);
+                updateHeap3D(src_heap_3D,
+                             heap_index[&d1_3D[curL][tmpY][curX] - d1_base],
+                             d1_base,
+                             heap_index);
               }
             }
           }
@@ -1036,7 +1056,8 @@ void FastRouteCore::mazeRouteMSMDOrder3D(int expand,
                 pr_3D_[curL][tmpY][curX].y = curY;
                 directions_3D[curL][tmpY][curX] = Direction::South;
                 src_heap_3D.push_back(&d1_3D[curL][tmpY][curX]);
-                updateHeap3D(src_heap_3D, src_heap_3D.size() - 1);
+                updateHeap3D(
+                    src_heap_3D, src_heap_3D.size() - 1, d1_base, heap_index);
               } else if (d1_3D[curL][tmpY][curX]
                          > tmp)  // top neighbor been put into src_heap_3D
                                  // but needs update
@@ -1046,11 +1067,10 @@ void FastRouteCore::mazeRouteMSMDOrder3D(int expand,
                 pr_3D_[curL][tmpY][curX].x = curX;
                 pr_3D_[curL][tmpY][curX].y = curY;
                 directions_3D[curL][tmpY][curX] = Direction::South;
-                const int* dtmp = &d1_3D[curL][tmpY][curX];
-                int ind = 0;
-                while (src_heap_3D[ind] != dtmp)
-                  ind++;
-                updateHeap3D(src_heap_3D, ind);
+                updateHeap3D(src_heap_3D,
+                             heap_index[&d1_3D[curL][tmpY][curX] - d1_base],
+                             d1_base,
+                             heap_index);
               }
             }
           }
@@ -1070,7 +1090,8 @@ void FastRouteCore::mazeRouteMSMDOrder3D(int expand,
             pr_3D_[tmpL][curY][curX].y = curY;
             directions_3D[tmpL][curY][curX] = Direction::Down;
             src_heap_3D.push_back(&d1_3D[tmpL][curY][curX]);
-            updateHeap3D(src_heap_3D, src_heap_3D.size() - 1);
+            updateHeap3D(
+                src_heap_3D, src_heap_3D.size() - 1, d1_base, heap_index);
           } else if (d1_3D[tmpL][curY][curX]
                      > tmp)  // bottom neighbor been put into src_heap_3D
                              // but needs update
@@ -1080,11 +1101,10 @@ void FastRouteCore::mazeRouteMSMDOrder3D(int expand,
             pr_3D_[tmpL][curY][curX].x = curX;
             pr_3D_[tmpL][curY][curX].y = curY;
             directions_3D[tmpL][curY][curX] = Direction::Down;
-            const int* dtmp = &d1_3D[tmpL][curY][curX];
-            int ind = 0;
-            while (src_heap_3D[ind] != dtmp)
-              ind++;
-            updateHeap3D(src_heap_3D, ind);
+            updateHeap3D(src_heap_3D,
+                         heap_index[&d1_3D[tmpL][curY][curX] - d1_base],
+                         d1_base,
+                         heap_index);
           }
         }
 
@@ -1102,7 +1122,8 @@ void FastRouteCore::mazeRouteMSMDOrder3D(int expand,
             pr_3D_[tmpL][curY][curX].y = curY;
             directions_3D[tmpL][curY][curX] = Direction::Up;
             src_heap_3D.push_back(&d1_3D[tmpL][curY][curX]);
-            updateHeap3D(src_heap_3D, src_heap_3D.size() - 1);
+            updateHeap3D(
+                src_heap_3D, src_heap_3D.size() - 1, d1_base, heap_index);
           } else if (d1_3D[tmpL][curY][curX]
                      > tmp)  // bottom neighbor been put into src_heap_3D
                              // but needs update
@@ -1112,11 +1133,10 @@ void FastRouteCore::mazeRouteMSMDOrder3D(int expand,
             pr_3D_[tmpL][curY][curX].x = curX;
             pr_3D_[tmpL][curY][curX].y = curY;
             directions_3D[tmpL][curY][curX] = Direction::Up;
-            const int* dtmp = &d1_3D[tmpL][curY][curX];
-            int ind = 0;
-            while (src_heap_3D[ind] != dtmp)
-              ind++;
-            updateHeap3D(src_heap_3D, ind);
+            updateHeap3D(src_heap_3D,
+                         heap_index[&d1_3D[tmpL][curY][curX] - d1_base],
+                         d1_base,
+                         heap_index);
           }
         }
 
@@ -64,7 +64,10 @@ void FastRouteCore::printEdge(int const netID, int const edgeID)
 
 void FastRouteCore::ConvertToFull3DType2()
 {
-  for (const int& netID : net_ids_) {
+  const int num_nets = net_ids_.size();
+#pragma omp parallel for num_threads(num_threads_) schedule(dynamic, 64)
+  for (int i = 0; i < num_nets; i++) {
+    const int netID = net_ids_[i];
     auto& treeedges = sttrees_[netID].edges;
     const int num_edges = sttrees_[netID].num_edges();
 
@@ -832,37 +835,31 @@ void FastRouteCore::assignEdge(int netID, int edgeID, bool processDIR)
 
 void FastRouteCore::layerAssignmentV4()
 {
-  int i, k, edgeID, nodeID, routeLen;
-  int n1, n2, connectionCNT;
-
-  int n1a, n2a;
   std::queue<int> edgeQueue;
 
-  TreeEdge* treeedge;
-
-  for (const int& netID : net_ids_) {
-    auto& treeedges = sttrees_[netID].edges;
-    for (edgeID = 0; edgeID < sttrees_[netID].num_edges(); edgeID++) {
-      treeedge = &(treeedges[edgeID]);
-      if (treeedge->len > 0) {
-        routeLen = treeedge->route.routelen;
-        treeedge->route.gridsL.resize(routeLen + 1, 0);
-        treeedge->assigned = false;
+  const int num_nets = net_ids_.size();
+#pragma omp parallel for num_threads(num_threads_) schedule(dynamic, 64)
+  for (int i = 0; i < num_nets; i++) {
+    auto& treeedges = sttrees_[net_ids_[i]].edges;
+    for (TreeEdge& edge : treeedges) {
+      if (edge.len > 0) {
+        edge.route.gridsL.resize(edge.route.routelen + 1, 0);
+        edge.assigned = false;
       }
     }
   }
   netpinOrderInc();
 
-  for (i = 0; i < tree_order_pv_.size(); i++) {
-    int netID = tree_order_pv_[i].treeIndex;
+  for (int i = 0; i < tree_order_pv_.size(); i++) {
+    const int netID = tree_order_pv_[i].treeIndex;
 
     auto& treeedges = sttrees_[netID].edges;
     auto& treenodes = sttrees_[netID].nodes;
     const int num_terminals = sttrees_[netID].num_terminals;
 
-    for (nodeID = 0; nodeID < num_terminals; nodeID++) {
-      for (k = 0; k < treenodes[nodeID].conCNT; k++) {
-        edgeID = treenodes[nodeID].eID[k];
+    for (int nodeID = 0; nodeID < num_terminals; nodeID++) {
+      for (int k = 0; k < treenodes[nodeID].conCNT; k++) {
+        const int edgeID = treenodes[nodeID].eID[k];
         if (!treeedges[edgeID].assigned) {
           edgeQueue.push(edgeID);
           treeedges[edgeID].assigned = true;
@@ -871,14 +868,14 @@ void FastRouteCore::layerAssignmentV4()
     }
 
     while (!edgeQueue.empty()) {
-      edgeID = edgeQueue.front();
+      int edgeID = edgeQueue.front();
       edgeQueue.pop();
-      treeedge = &(treeedges[edgeID]);
+      TreeEdge* treeedge = &(treeedges[edgeID]);
       if (treenodes[treeedge->n1a].assigned) {
         assignEdge(netID, edgeID, 1);
         treeedge->assigned = true;
         if (!treenodes[treeedge->n2a].assigned) {
-          for (k = 0; k < treenodes[treeedge->n2a].conCNT; k++) {
+          for (int k = 0; k < treenodes[treeedge->n2a].conCNT; k++) {
             edgeID = treenodes[treeedge->n2a].eID[k];
             if (!treeedges[edgeID].assigned) {
               edgeQueue.push(edgeID);
@@ -891,7 +888,7 @@ void FastRouteCore::layerAssignmentV4()
         assignEdge(netID, edgeID, 0);
         treeedge->assigned = true;
         if (!treenodes[treeedge->n1a].assigned) {
-          for (k = 0; k < treenodes[treeedge->n1a].conCNT; k++) {
+          for (int k = 0; k < treenodes[treeedge->n1a].conCNT; k++) {
             edgeID = treenodes[treeedge->n1a].eID[k];
             if (!treeedges[edgeID].assigned) {
               edgeQueue.push(edgeID);
@@ -902,8 +899,20 @@ void FastRouteCore::layerAssignmentV4()
         }
       }
     }
+  }
 
-    for (nodeID = 0; nodeID < sttrees_[netID].num_nodes(); nodeID++) {
+  // assignEdge updates the shared 3D usage so the loop above has to run in
+  // order.  Rebuilding the node layer ranges from the assigned edges only
+  // touches each net's own tree and is done in parallel.
+#pragma omp parallel for num_threads(num_threads_) schedule(dynamic, 64)
+  for (int i = 0; i < num_nets; i++) {
+    const int netID = net_ids_[i];
+
+    auto& treeedges = sttrees_[netID].edges;
+    auto& treenodes = sttrees_[netID].nodes;
+    const int num_terminals = sttrees_[netID].num_terminals;
+
+    for (int nodeID = 0; nodeID < sttrees_[netID].num_nodes(); nodeID++) {
       treenodes[nodeID].topL = -1;
       treenodes[nodeID].botL = num_layers_;
       treenodes[nodeID].conCNT = 0;
@@ -920,19 +929,19 @@ void FastRouteCore::layerAssignmentV4()
       }
     }
 
-    for (edgeID = 0; edgeID < sttrees_[netID].num_edges(); edgeID++) {
-      treeedge = &(treeedges[edgeID]);
+    for (int edgeID = 0; edgeID < sttrees_[netID].num_edges(); edgeID++) {
+      const TreeEdge* treeedge = &(treeedges[edgeID]);
 
       if (treeedge->len > 0) {
-        routeLen = treeedge->route.routelen;
+        const int routeLen = treeedge->route.routelen;
 
-        n1 = treeedge->n1;
-        n2 = treeedge->n2;
+        const int n1 = treeedge->n1;
+        const int n2 = treeedge->n2;
         const std::vector<short>& gridsL = treeedge->route.gridsL;
 
-        n1a = treenodes[n1].stackAlias;
-        n2a = treenodes[n2].stackAlias;
-        connectionCNT = treenodes[n1a].conCNT;
+        const int n1a = treenodes[n1].stackAlias;
+        const int n2a = treenodes[n2].stackAlias;
+        int connectionCNT = treenodes[n1a].conCNT;
         treenodes[n1a].heights[connectionCNT] = gridsL[0];
         treenodes[n1a].eID[connectionCNT] = edgeID;
         treenodes[n1a].conCNT++;
@@ -970,73 +979,83 @@ void FastRouteCore::layerAssignmentV4()
 
 void FastRouteCore::layerAssignment()
 {
-  int d, k, edgeID, numpoints, n1, n2;
-  bool redundant;
-  TreeEdge* treeedge;
-
-  for (const int& netID : net_ids_) {
-    auto& treenodes = sttrees_[netID].nodes;
-
-    numpoints = 0;
-
-    for (d = 0; d < sttrees_[netID].num_nodes(); d++) {
-      treenodes[d].topL = -1;
-      treenodes[d].botL = num_layers_;
-      // treenodes[d].l = 0;
-      treenodes[d].assigned = false;
-      treenodes[d].stackAlias = d;
-      treenodes[d].conCNT = 0;
-      treenodes[d].hID = BIG_INT;
-      treenodes[d].lID = BIG_INT;
-      treenodes[d].status = 0;
-
-      if (d < sttrees_[netID].num_terminals) {
-        treenodes[d].botL = nets_[netID]->getPinL()[d];
-        treenodes[d].topL = nets_[netID]->getPinL()[d];
+  // Collapsing stacked nodes only touches the tree of each net, so the nets
+  // are processed in parallel.
+  const int num_nets = net_ids_.size();
+#pragma omp parallel num_threads(num_threads_)
+  {
+    std::vector<int> xcor;
+    std::vector<int> ycor;
+    std::vector<int> dcor;
+
+#pragma omp for schedule(dynamic, 64)
+    for (int i = 0; i < num_nets; i++) {
+      const int netID = net_ids_[i];
+      auto& treeedges = sttrees_[netID].edges;
+      auto& treenodes = sttrees_[netID].nodes;
+      const int num_nodes = sttrees_[netID].num_nodes();
+
+      xcor.resize(num_nodes);
+      ycor.resize(num_nodes);
+      dcor.resize(num_nodes);
+      int numpoints = 0;
+
+      for (int d = 0; d < num_nodes; d++) {
+        treenodes[d].topL = -1;
+        treenodes[d].botL = num_layers_;
         // treenodes[d].l = 0;
-        treenodes[d].assigned = true;
-        treenodes[d].status = 1;
-
-        xcor_[numpoints] = treenodes[d].x;
-        ycor_[numpoints] = treenodes[d].y;
-        dcor_[numpoints] = d;
-        numpoints++;
-      } else {
-        redundant = false;
-        for (k = 0; k < numpoints; k++) {
-          if ((treenodes[d].x == xcor_[k]) && (treenodes[d].y == ycor_[k])) {
-            treenodes[d].stackAlias = dcor_[k];
+        treenodes[d].assigned = false;
+        treenodes[d].stackAlias = d;
+        treenodes[d].conCNT = 0;
+        treenodes[d].hID = BIG_INT;
+        treenodes[d].lID = BIG_INT;
+        treenodes[d].status = 0;
+
+        if (d < sttrees_[netID].num_terminals) {
+          treenodes[d].botL = nets_[netID]->getPinL()[d];
+          treenodes[d].topL = nets_[netID]->getPinL()[d];
+          // treenodes[d].l = 0;
+          treenodes[d].assigned = true;
+          treenodes[d].status = 1;
+
+          xcor[numpoints] = treenodes[d].x;
+          ycor[numpoints] = treenodes[d].y;
+          dcor[numpoints] = d;
+          numpoints++;
+        } else {
+          bool redundant = false;
+          for (int k = 0; k < numpoints; k++) {
+            if ((treenodes[d].x == xcor[k]) && (treenodes[d].y == ycor[k])) {
+              treenodes[d].stackAlias = dcor[k];
 
-            redundant = true;
-            break;
+              redundant = true;
+              break;
+            }
+          }
+          if (!redundant) {
+            xcor[numpoints] = treenodes[d].x;
+            ycor[numpoints] = treenodes[d].y;
+            dcor[numpoints] = d;
+            numpoints++;
           }
-        }
-        if (!redundant) {
-          xcor_[numpoints] = treenodes[d].x;
-          ycor_[numpoints] = treenodes[d].y;
-          dcor_[numpoints] = d;
-          numpoints++;
         }
       }
-    }
-  }
 
-  for (const int& netID : net_ids_) {
-    auto& treeedges = sttrees_[netID].edges;
-    auto& treenodes = sttrees_[netID].nodes;
+      for (int edgeID = 0; edgeID < sttrees_[netID].num_edges(); edgeID++) {
+        TreeEdge* treeedge = &(treeedges[edgeID]);
+        if (treeedge->len > 0) {
+          const int n1 = treeedge->n1;
+          const int n2 = treeedge->n2;
 
-    for (edgeID = 0; edgeID < sttrees_[netID].num_edges(); edgeID++) {
-      treeedge = &(treeedges[edgeID]);
-      if (treeedge->len > 0) {
-        n1 = treeedge->n1;
-        n2 = treeedge->n2;
-
-        treeedge->n1a = treenodes[n1].stackAlias;
-        treenodes[treeedge->n1a].eID[treenodes[treeedge->n1a].conCNT] = edgeID;
-        treenodes[treeedge->n1a].conCNT++;
-        treeedge->n2a = treenodes[n2].stackAlias;
-        treenodes[treeedge->n2a].eID[treenodes[treeedge->n2a].conCNT] = edgeID;
-        treenodes[treeedge->n2a].conCNT++;
+          treeedge->n1a = treenodes[n1].stackAlias;
+          treenodes[treeedge->n1a].eID[treenodes[treeedge->n1a].conCNT]
+              = edgeID;
+          treenodes[treeedge->n1a].conCNT++;
+          treeedge->n2a = treenodes[n2].stackAlias;
+          treenodes[treeedge->n2a].eID[treenodes[treeedge->n2a].conCNT]
+              = edgeID;
+          treenodes[treeedge->n2a].conCNT++;
+        }
       }
     }
   }
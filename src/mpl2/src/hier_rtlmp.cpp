@@ -59,6 +59,32 @@ using std::string;
 // Class HierRTLMP
 using utl::MPL;
 
+// Call func(i) for every i in [0, count) using up to num_threads threads.
+// func must only write state owned by index i.
+template <typename Func>
+static void parallelFor(const int count, int num_threads, const Func& func)
+{
+  num_threads = std::max(1, std::min(num_threads, count));
+  if (num_threads == 1) {
+    for (int i = 0; i < count; i++) {
+      func(i);
+    }
+    return;
+  }
+  std::vector<std::thread> threads;
+  threads.reserve(num_threads);
+  for (int t = 0; t < num_threads; t++) {
+    threads.emplace_back([&func, count, num_threads, t]() {
+      for (int i = t; i < count; i += num_threads) {
+        func(i);
+      }
+    });
+  }
+  for (auto& th : threads) {
+    th.join();
+  }
+}
+
 HierRTLMP::~HierRTLMP() = default;
 
 // Constructors
@@ -1493,13 +1519,66 @@ void HierRTLMP::calculateConnection()
     cluster->initConnection();
   }
 
+  if (!connection_nets_valid_) {
+    collectConnectionNets();
+  }
+
+  // Map the drivers and loads of each net to their current clusters in
+  // parallel. The connections are then added serially in net order, so the
+  // accumulated weights are the same for any number of threads.
+  const int num_nets = connection_nets_.size();
+  std::vector<int> driver_cluster_ids(num_nets);
+  std::vector<int> load_ptr(num_nets + 1, 0);
+  for (int i = 0; i < num_nets; i++) {
+    const ConnectionNet& net = connection_nets_[i];
+    load_ptr[i + 1]
+        = load_ptr[i] + net.load_insts.size() + net.load_bterms.size();
+  }
+  std::vector<int> load_clusters_ids(load_ptr[num_nets]);
+
+  parallelFor(num_nets, num_threads_, [&](const int i) {
+    const ConnectionNet& net = connection_nets_[i];
+    driver_cluster_ids[i] = net.driver_bterm != nullptr
+                                ? bterm_to_cluster_.at(net.driver_bterm)
+                                : inst_to_cluster_.at(net.driver_inst);
+    int load_idx = load_ptr[i];
+    for (odb::dbInst* inst : net.load_insts) {
+      load_clusters_ids[load_idx++] = inst_to_cluster_.at(inst);
+    }
+    for (odb::dbBTerm* bterm : net.load_bterms) {
+      load_clusters_ids[load_idx++] = bterm_to_cluster_.at(bterm);
+    }
+  });
+
+  for (int i = 0; i < num_nets; i++) {
+    if (load_ptr[i + 1] - load_ptr[i] >= large_net_threshold_) {
+      continue;
+    }
+    const int driver_cluster_id = driver_cluster_ids[i];
+    const float weight = connection_nets_[i].has_io_pin ? virtual_weight_ : 1.0;
+
+    for (int j = load_ptr[i]; j < load_ptr[i + 1]; j++) {
+      const int load_cluster_id = load_clusters_ids[j];
+      if (load_cluster_id != driver_cluster_id) { /* undirected connection */
+        cluster_map_[driver_cluster_id]->addConnection(load_cluster_id,
+                                                       weight);
+        cluster_map_[load_cluster_id]->addConnection(driver_cluster_id,
+                                                     weight);
+      }
+    }
+  }
+}
+
+void HierRTLMP::collectConnectionNets()
+{
+  connection_nets_.clear();
+
   for (odb::dbNet* net : block_->getNets()) {
     if (net->getSigType().isSupply()) {
       continue;
     }
 
-    int driver_cluster_id = -1;
-    std::vector<int> load_clusters_ids;
+    ConnectionNet connection_net;
     bool net_has_pad_or_cover = false;
 
     for (odb::dbITerm* iterm : net->getITerms()) {
@@ -1517,12 +1596,10 @@ void HierRTLMP::calculateConnection()
         break;
       }
 
-      const int cluster_id = inst_to_cluster_.at(inst);
-
       if (iterm->getIoType() == odb::dbIoType::OUTPUT) {
-        driver_cluster_id = cluster_id;
+        connection_net.driver_inst = inst;
       } else {
-        load_clusters_ids.push_back(cluster_id);
+        connection_net.load_insts.push_back(inst);
       }
     }
 
@@ -1530,33 +1607,26 @@ void HierRTLMP::calculateConnection()
       continue;
     }
 
-    bool net_has_io_pin = false;
-
     for (odb::dbBTerm* bterm : net->getBTerms()) {
-      const int cluster_id = bterm_to_cluster_.at(bterm);
-      net_has_io_pin = true;
+      connection_net.has_io_pin = true;
 
       if (bterm->getIoType() == odb::dbIoType::INPUT) {
-        driver_cluster_id = cluster_id;
+        connection_net.driver_bterm = bterm;
       } else {
-        load_clusters_ids.push_back(cluster_id);
+        connection_net.load_bterms.push_back(bterm);
       }
     }
 
-    if (driver_cluster_id != -1 && !load_clusters_ids.empty()
-        && load_clusters_ids.size() < large_net_threshold_) {
-      const float weight = net_has_io_pin ? virtual_weight_ : 1.0;
-
-      for (const int load_cluster_id : load_clusters_ids) {
-        if (load_cluster_id != driver_cluster_id) { /* undirected connection */
-          cluster_map_[driver_cluster_id]->addConnection(load_cluster_id,
-                                                         weight);
-          cluster_map_[load_cluster_id]->addConnection(driver_cluster_id,
-                                                       weight);
-        }
-      }
+    const bool has_driver = connection_net.driver_inst != nullptr
+                            || connection_net.driver_bterm != nullptr;
+    const bool has_loads = !connection_net.load_insts.empty()
+                           || !connection_net.load_bterms.empty();
+    if (has_driver && has_loads) {
+      connection_nets_.push_back(std::move(connection_net));
     }
   }
+
+  connection_nets_valid_ = true;
 }
 
 // Dataflow is used to improve quality of macro placement.
@@ -1708,7 +1778,14 @@ void HierRTLMP::createDataFlow()
       logger_, MPL, "multilevel_autoclustering", 1, "Created hypergraph");
 
   // traverse hypergraph to build dataflow
-  for (auto [src, src_pin] : io_pin_vertex) {
+  // The searches from different sources are independent, so they run in
+  // parallel and their results are appended in source order.
+  const std::vector<std::pair<int, odb::dbBTerm*>> io_pin_srcs(
+      io_pin_vertex.begin(), io_pin_vertex.end());
+  std::vector<std::vector<std::set<odb::dbInst*>>> io_pin_insts(
+      io_pin_srcs.size());
+  parallelFor(io_pin_srcs.size(), num_threads_, [&](const int i) {
+    const int src = io_pin_srcs[i].first;
     int idx = 0;
     std::vector<bool> visited(vertices.size(), false);
     std::vector<std::set<odb::dbInst*>> insts(max_num_ff_dist_);
@@ -1734,10 +1811,21 @@ void HierRTLMP::createDataFlow()
                      backward_vertices,
                      hyperedges,
                      true);
-    io_ffs_conn_map_.emplace_back(src_pin, insts);
-  }
-
-  for (auto [src, src_pin] : macro_pin_vertex) {
+    io_pin_insts[i] = std::move(insts);
+  });
+  for (int i = 0; i < io_pin_srcs.size(); i++) {
+    io_ffs_conn_map_.emplace_back(io_pin_srcs[i].second,
+                                  std::move(io_pin_insts[i]));
+  }
+
+  const std::vector<std::pair<int, odb::dbITerm*>> macro_pin_srcs(
+      macro_pin_vertex.begin(), macro_pin_vertex.end());
+  std::vector<std::vector<std::set<odb::dbInst*>>> macro_pin_std_cells(
+      macro_pin_srcs.size());
+  std::vector<std::vector<std::set<odb::dbInst*>>> macro_pin_macros(
+      macro_pin_srcs.size());
+  parallelFor(macro_pin_srcs.size(), num_threads_, [&](const int i) {
+    const int src = macro_pin_srcs[i].first;
     int idx = 0;
     std::vector<bool> visited(vertices.size(), false);
     std::vector<std::set<odb::dbInst*>> std_cells(max_num_ff_dist_);
@@ -1766,8 +1854,14 @@ void HierRTLMP::createDataFlow()
                         backward_vertices,
                         hyperedges,
                         true);
-    macro_ffs_conn_map_.emplace_back(src_pin, std_cells);
-    macro_macro_conn_map_.emplace_back(src_pin, macros);
+    macro_pin_std_cells[i] = std::move(std_cells);
+    macro_pin_macros[i] = std::move(macros);
+  });
+  for (int i = 0; i < macro_pin_srcs.size(); i++) {
+    odb::dbITerm* src_pin = macro_pin_srcs[i].second;
+    macro_ffs_conn_map_.emplace_back(src_pin,
+                                     std::move(macro_pin_std_cells[i]));
+    macro_macro_conn_map_.emplace_back(src_pin, std::move(macro_pin_macros[i]));
   }
 }
 
@@ -1775,26 +1869,27 @@ void HierRTLMP::createDataFlow()
 // Forward or Backward DFS search to find sequential paths from/to IO pins based
 // on hop count to macro pins
 //
-void HierRTLMP::dataFlowDFSIOPin(int parent,
-                                 int idx,
-                                 std::vector<std::set<odb::dbInst*>>& insts,
-                                 std::map<int, odb::dbBTerm*>& io_pin_vertex,
-                                 std::map<int, odb::dbInst*>& std_cell_vertex,
-                                 std::map<int, odb::dbITerm*>& macro_pin_vertex,
-                                 std::vector<bool>& stop_flag_vec,
-                                 std::vector<bool>& visited,
-                                 std::vector<std::vector<int>>& vertices,
-                                 std::vector<std::vector<int>>& hyperedges,
-                                 bool backward_flag)
+void HierRTLMP::dataFlowDFSIOPin(
+    int parent,
+    int idx,
+    std::vector<std::set<odb::dbInst*>>& insts,
+    const std::map<int, odb::dbBTerm*>& io_pin_vertex,
+    const std::map<int, odb::dbInst*>& std_cell_vertex,
+    const std::map<int, odb::dbITerm*>& macro_pin_vertex,
+    const std::vector<bool>& stop_flag_vec,
+    std::vector<bool>& visited,
+    const std::vector<std::vector<int>>& vertices,
+    const std::vector<std::vector<int>>& hyperedges,
+    bool backward_flag)
 {
   visited[parent] = true;
   if (stop_flag_vec[parent]) {
     if (parent < io_pin_vertex.size()) {
       ;  // currently we do not consider IO pin to IO pin connnection
     } else if (parent < io_pin_vertex.size() + std_cell_vertex.size()) {
-      insts[idx].insert(std_cell_vertex[parent]);
+      insts[idx].insert(std_cell_vertex.at(parent));
     } else {
-      insts[idx].insert(macro_pin_vertex[parent]->getInst());
+      insts[idx].insert(macro_pin_vertex.at(parent)->getInst());
     }
     idx++;
   }
@@ -1854,13 +1949,13 @@ void HierRTLMP::dataFlowDFSMacroPin(
     int idx,
     std::vector<std::set<odb::dbInst*>>& std_cells,
     std::vector<std::set<odb::dbInst*>>& macros,
-    std::map<int, odb::dbBTerm*>& io_pin_vertex,
-    std::map<int, odb::dbInst*>& std_cell_vertex,
-    std::map<int, odb::dbITerm*>& macro_pin_vertex,
-    std::vector<bool>& stop_flag_vec,
+    const std::map<int, odb::dbBTerm*>& io_pin_vertex,
+    const std::map<int, odb::dbInst*>& std_cell_vertex,
+    const std::map<int, odb::dbITerm*>& macro_pin_vertex,
+    const std::vector<bool>& stop_flag_vec,
     std::vector<bool>& visited,
-    std::vector<std::vector<int>>& vertices,
-    std::vector<std::vector<int>>& hyperedges,
+    const std::vector<std::vector<int>>& vertices,
+    const std::vector<std::vector<int>>& hyperedges,
     bool backward_flag)
 {
   visited[parent] = true;
@@ -1868,9 +1963,9 @@ void HierRTLMP::dataFlowDFSMacroPin(
     if (parent < io_pin_vertex.size()) {
       ;  // the connection between IO and macro pins have been considers
     } else if (parent < io_pin_vertex.size() + std_cell_vertex.size()) {
-      std_cells[idx].insert(std_cell_vertex[parent]);
+      std_cells[idx].insert(std_cell_vertex.at(parent));
     } else {
-      macros[idx].insert(macro_pin_vertex[parent]->getInst());
+      macros[idx].insert(macro_pin_vertex.at(parent)->getInst());
     }
     idx++;
   }
@@ -6237,6 +6332,9 @@ void HierRTLMP::clear()
   }
   cluster_map_.clear();
 
+  connection_nets_.clear();
+  connection_nets_valid_ = false;
+
   if (graphics_) {
     graphics_->eraseDrawing();
   }
@@ -150,29 +150,31 @@ class HierRTLMP
   void dataFlowDFSIOPin(int parent,
                         int idx,
                         std::vector<std::set<odb::dbInst*>>& insts,
-                        std::map<int, odb::dbBTerm*>& io_pin_vertex,
-                        std::map<int, odb::dbInst*>& std_cell_vertex,
-                        std::map<int, odb::dbITerm*>& macro_pin_vertex,
-                        std::vector<bool>& stop_flag_vec,
+                        const std::map<int, odb::dbBTerm*>& io_pin_vertex,
+                        const std::map<int, odb::dbInst*>& std_cell_vertex,
+                        const std::map<int, odb::dbITerm*>& macro_pin_vertex,
+                        const std::vector<bool>& stop_flag_vec,
                         std::vector<bool>& visited,
-                        std::vector<std::vector<int>>& vertices,
-                        std::vector<std::vector<int>>& hyperedges,
+                        const std::vector<std::vector<int>>& vertices,
+                        const std::vector<std::vector<int>>& hyperedges,
                         bool backward_flag);
-  void dataFlowDFSMacroPin(int parent,
-                           int idx,
-                           std::vector<std::set<odb::dbInst*>>& std_cells,
-                           std::vector<std::set<odb::dbInst*>>& macros,
-                           std::map<int, odb::dbBTerm*>& io_pin_vertex,
-                           std::map<int, odb::dbInst*>& std_cell_vertex,
-                           std::map<int, odb::dbITerm*>& macro_pin_vertex,
-                           std::vector<bool>& stop_flag_vec,
-                           std::vector<bool>& visited,
-                           std::vector<std::vector<int>>& vertices,
-                           std::vector<std::vector<int>>& hyperedges,
-                           bool backward_flag);
+  void dataFlowDFSMacroPin(
+      int parent,
+      int idx,
+      std::vector<std::set<odb::dbInst*>>& std_cells,
+      std::vector<std::set<odb::dbInst*>>& macros,
+      const std::map<int, odb::dbBTerm*>& io_pin_vertex,
+      const std::map<int, odb::dbInst*>& std_cell_vertex,
+      const std::map<int, odb::dbITerm*>& macro_pin_vertex,
+      const std::vector<bool>& stop_flag_vec,
+      std::vector<bool>& visited,
+      const std::vector<std::vector<int>>& vertices,
+      const std::vector<std::vector<int>>& hyperedges,
+      bool backward_flag);
   Metrics* computeMetrics(odb::dbModule* module);
   void setClusterMetrics(Cluster* cluster);
   void calculateConnection();
+  void collectConnectionNets();
   void getHardMacros(odb::dbModule* module,
                      std::vector<HardMacro*>& hard_macros);
   void clear();
@@ -473,6 +475,20 @@ class HierRTLMP
   std::unordered_map<odb::dbInst*, int> inst_to_cluster_;    // inst, id
   std::unordered_map<odb::dbBTerm*, int> bterm_to_cluster_;  // io pin, id
 
+  // Signal nets reduced to the drivers and loads used by
+  // calculateConnection. The netlist does not change during clustering, so
+  // they are collected once and only mapped to clusters on each call.
+  struct ConnectionNet
+  {
+    odb::dbInst* driver_inst = nullptr;
+    odb::dbBTerm* driver_bterm = nullptr;  // overrides driver_inst
+    std::vector<odb::dbInst*> load_insts;
+    std::vector<odb::dbBTerm*> load_bterms;
+    bool has_io_pin = false;
+  };
+  std::vector<ConnectionNet> connection_nets_;
+  bool connection_nets_valid_ = false;
+
   // All the bundled IOs are children of root_cluster_
   // Bundled IO (Pads)
   // In the bundled IO clusters, we don't store the ios in their corresponding
@@ -385,9 +385,11 @@ class dbDatabase : public dbObject
 
   ///
   /// Write a database to this stream.
+  /// The block tables are serialized on up to num_threads threads; the
+  /// output is identical regardless of the thread count.
   /// Throws ZIOError..
   ///
-  void write(std::ostream& file);
+  void write(std::ostream& file, int num_threads = 1);
 
   ///
   /// ECO - The following methods implement a simple ECO mechanism for capturing
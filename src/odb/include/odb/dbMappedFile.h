@@ -0,0 +1,79 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2024, The Regents of the University of California
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+#include <streambuf>
+
+namespace odb {
+
+// A read-only std::streambuf over a memory mapped file.  The whole file is
+// exposed as the get area so the stream never has to refill a buffer and
+// dbIStream can copy scalars straight out of the mapping.
+class dbMappedFileBuf : public std::streambuf
+{
+ public:
+  explicit dbMappedFileBuf(const char* filename);
+  ~dbMappedFileBuf() override;
+
+  dbMappedFileBuf(const dbMappedFileBuf&) = delete;
+  dbMappedFileBuf& operator=(const dbMappedFileBuf&) = delete;
+
+  bool isOpen() const { return data_ != nullptr; }
+  size_t size() const { return size_; }
+
+  // Copy n bytes from the current position.  Returns false, without
+  // consuming anything, if fewer than n bytes remain.
+  bool read(char* dst, size_t n)
+  {
+    if (static_cast<size_t>(egptr() - gptr()) < n) {
+      return false;
+    }
+    std::memcpy(dst, gptr(), n);
+    setg(eback(), gptr() + n, egptr());
+    return true;
+  }
+
+ protected:
+  pos_type seekoff(off_type off,
+                   std::ios_base::seekdir dir,
+                   std::ios_base::openmode which) override;
+  pos_type seekpos(pos_type pos, std::ios_base::openmode which) override;
+
+ private:
+  char* data_ = nullptr;
+  size_t size_ = 0;
+};
+
+}  // namespace odb
@@ -42,6 +42,7 @@
 #include <variant>
 
 #include "ZException.h"
+#include "dbMappedFile.h"
 #include "dbObject.h"
 #include "map"
 #include "odb.h"
@@ -68,6 +69,12 @@ class dbOStream
   double _lef_area_factor;
   double _lef_dist_factor;
   std::vector<Scope> _scopes;
+  int _num_threads = 1;
+  // Scope names of the stream this one writes a part of, eg
+  // "dbDatabase/dbChip/dbBlock/".
+  std::string _parent_scope;
+  // When set, io_size reports are collected here instead of logged.
+  std::vector<std::string>* _io_size_reports = nullptr;
 
   // By default values are written as their string ("255" vs 0xFF)
   // representations when using the << stream method. In dbOstream we are
@@ -83,6 +90,20 @@ class dbOStream
 
   _dbDatabase* getDatabase() { return _db; }
 
+  // Number of threads that may be used to serialize independent tables.
+  void setNumThreads(int num_threads) { _num_threads = num_threads; }
+  int getNumThreads() const { return _num_threads; }
+
+  // Append the bytes serialized into buf verbatim, without copying them.
+  // buf must be readable, eg the rdbuf() of a std::stringstream.
+  void writeBytes(std::streambuf* buf);
+
+  // Make this stream write a part of parent from another thread.  The
+  // io_size reports keep the parent's scope names and are returned in
+  // reports for the caller to log in a deterministic order.
+  void setParentScope(const dbOStream& parent,
+                      std::vector<std::string>* reports);
+
   dbOStream& operator<<(bool c)
   {
     unsigned char b = (c == true ? 1 : 0);
@@ -272,6 +293,7 @@ class dbOStream
 
   void pushScope(const std::string& name);
   void popScope();
+  std::string getScopeName() const;
 };
 
 // RAII class for scoping ostream operations
@@ -292,10 +314,26 @@ class dbOStreamScope
 class dbIStream
 {
   std::istream& _f;
+  // Set when _f reads from a memory mapped file so scalars can be copied
+  // directly out of the mapping instead of going through istream::read.
+  dbMappedFileBuf* _mapped;
   _dbDatabase* _db;
   double _lef_area_factor;
   double _lef_dist_factor;
 
+  void readBytes(char* c, size_t n)
+  {
+    if (_mapped == nullptr || !_mapped->read(c, n)) {
+      _f.read(c, n);
+    }
+  }
+
+  template <typename T>
+  void readValueAsBytes(T& type)
+  {
+    readBytes(reinterpret_cast<char*>(&type), sizeof(T));
+  }
+
  public:
   dbIStream(_dbDatabase* db, std::istream& f);
 
@@ -311,67 +349,67 @@ class dbIStream
 
   dbIStream& operator>>(char& c)
   {
-    _f.read(reinterpret_cast<char*>(&c), sizeof(c));
+    readValueAsBytes(c);
     return *this;
   }
 
   dbIStream& operator>>(unsigned char& c)
   {
-    _f.read(reinterpret_cast<char*>(&c), sizeof(c));
+    readValueAsBytes(c);
     return *this;
   }
 
   dbIStream& operator>>(int16_t& c)
   {
-    _f.read(reinterpret_cast<char*>(&c), sizeof(c));
+    readValueAsBytes(c);
     return *this;
   }
 
   dbIStream& operator>>(uint16_t& c)
   {
-    _f.read(reinterpret_cast<char*>(&c), sizeof(c));
+    readValueAsBytes(c);
     return *this;
   }
 
   dbIStream& operator>>(int& c)
   {
-    _f.read(reinterpret_cast<char*>(&c), sizeof(c));
+    readValueAsBytes(c);
     return *this;
   }
 
   dbIStream& operator>>(uint64_t& c)
   {
-    _f.read(reinterpret_cast<char*>(&c), sizeof(c));
+    readValueAsBytes(c);
     return *this;
   }
 
   dbIStream& operator>>(unsigned int& c)
   {
-    _f.read(reinterpret_cast<char*>(&c), sizeof(c));
+    readValueAsBytes(c);
     return *this;
   }
 
   dbIStream& operator>>(int8_t& c)
   {
-    _f.read(reinterpret_cast<char*>(&c), sizeof(c));
+    readValueAsBytes(c);
     return *this;
   }
 
   dbIStream& operator>>(float& c)
   {
-    _f.read(reinterpret_cast<char*>(&c), sizeof(c));
+    readValueAsBytes(c);
     return *this;
   }
 
   dbIStream& operator>>(double& c)
   {
-    _f.read(reinterpret_cast<char*>(&c), sizeof(c));
+    readValueAsBytes(c);
     return *this;
   }
 
   dbIStream& operator>>(long double& c)
   {
-    _f.read(reinterpret_cast<char*>(&c), sizeof(c));
+    readValueAsBytes(c);
     return *this;
   }
 
@@ -384,7 +422,7 @@ class dbIStream
       c = nullptr;
     } else {
       c = (char*) malloc(l);
-      _f.read(reinterpret_cast<char*>(c), l);
+      readBytes(c, l);
     }
 
     return *this;
@@ -392,7 +430,7 @@ class dbIStream
 
   dbIStream& operator>>(dbObjectType& c)
   {
-    _f.read(reinterpret_cast<char*>(&c), sizeof(c));
+    readValueAsBytes(c);
     return *this;
   }
 
@@ -35,10 +35,19 @@
 #include <errno.h>
 #include <unistd.h>
 
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
 #include <fstream>
+#include <functional>
 #include <memory>
+#include <mutex>
 #include <set>
+#include <sstream>
 #include <string>
+#include <thread>
+#include <vector>
 
 #include "dbAccessPoint.h"
 #include "dbArrayTable.h"
@@ -929,6 +938,84 @@ dbObjectTable* _dbBlock::getObjectTable(dbObjectType type)
   return getTable()->getObjectTable(type);
 }
 
+// Serialize each table into a private buffer, using up to the stream's
+// thread count, and append the buffers to the stream in order as soon as
+// they are complete.  The result is byte for byte what writing the tables
+// sequentially would produce.  An exception from a table or from the
+// stream stops the workers, joins them and is rethrown to the caller.
+static void writeTables(
+    dbOStream& stream,
+    const std::vector<std::function<void(dbOStream&)>>& tables)
+{
+  const int num_threads = std::min<int>(stream.getNumThreads(), tables.size());
+  if (num_threads <= 1) {
+    for (const auto& table : tables) {
+      table(stream);
+    }
+    return;
+  }
+
+  std::vector<std::stringstream> buffers(tables.size());
+  std::vector<std::vector<std::string>> io_size_reports(tables.size());
+  std::vector<std::exception_ptr> errors(tables.size());
+  std::vector<bool> done(tables.size(), false);
+  std::mutex done_mutex;
+  std::condition_variable done_cv;
+  std::atomic<size_t> next = 0;
+  std::atomic<bool> stop = false;
+  std::vector<std::thread> threads;
+  threads.reserve(num_threads);
+  auto join_threads = [&]() {
+    stop = true;
+    for (auto& thread : threads) {
+      if (thread.joinable()) {
+        thread.join();
+      }
+    }
+  };
+
+  try {
+    for (int i = 0; i < num_threads; ++i) {
+      threads.emplace_back([&]() {
+        for (size_t idx = next++; idx < tables.size() && !stop; idx = next++) {
+          try {
+            dbOStream table_stream(stream.getDatabase(), buffers[idx]);
+            table_stream.setParentScope(stream, &io_size_reports[idx]);
+            tables[idx](table_stream);
+          } catch (...) {
+            errors[idx] = std::current_exception();
+          }
+          {
+            std::lock_guard<std::mutex> lock(done_mutex);
+            done[idx] = true;
+          }
+          done_cv.notify_one();
+        }
+      });
+    }
+
+    utl::Logger* logger = stream.getDatabase()->getLogger();
+    for (size_t idx = 0; idx < tables.size(); ++idx) {
+      {
+        std::unique_lock<std::mutex> lock(done_mutex);
+        done_cv.wait(lock, [&]() { return done[idx]; });
+      }
+      if (errors[idx]) {
+        std::rethrow_exception(errors[idx]);
+      }
+      stream.writeBytes(buffers[idx].rdbuf());
+      std::stringstream().swap(buffers[idx]);
+      for (const std::string& report : io_size_reports[idx]) {
+        logger->report("{}", report);
+      }
+    }
+  } catch (...) {
+    join_threads();
+    throw;
+  }
+  join_threads();
+}
+
 dbOStream& operator<<(dbOStream& stream, const _dbBlock& block)
 {
   std::list<dbBlockCallBackObj*>::const_iterator cbitr;
@@ -982,53 +1069,60 @@ dbOStream& operator<<(dbOStream& stream, const _dbBlock& block)
   stream << block._component_mask_shift;
   stream << block._currentCcAdjOrder;
 
-  stream << *block._bterm_tbl;
-  stream << *block._iterm_tbl;
-  stream << *block._net_tbl;
-  stream << *block._inst_hdr_tbl;
-  stream << *block._inst_tbl;
-  stream << *block._module_tbl;
-  stream << *block._modinst_tbl;
+  // The tables below are independent of each other so they are serialized
+  // concurrently and appended in this order.
+  std::vector<std::function<void(dbOStream&)>> tables;
+  tables.emplace_back([&](dbOStream& s) { s << *block._bterm_tbl; });
+  tables.emplace_back([&](dbOStream& s) { s << *block._iterm_tbl; });
+  tables.emplace_back([&](dbOStream& s) { s << *block._net_tbl; });
+  tables.emplace_back([&](dbOStream& s) { s << *block._inst_hdr_tbl; });
+  tables.emplace_back([&](dbOStream& s) { s << *block._inst_tbl; });
+  tables.emplace_back([&](dbOStream& s) { s << *block._module_tbl; });
+  tables.emplace_back([&](dbOStream& s) { s << *block._modinst_tbl; });
   if (db->isSchema(db_schema_update_hierarchy)) {
-    stream << *block._modbterm_tbl;
-    stream << *block._moditerm_tbl;
-    stream << *block._modnet_tbl;
-  }
-  stream << *block._powerdomain_tbl;
-  stream << *block._logicport_tbl;
-  stream << *block._powerswitch_tbl;
-  stream << *block._isolation_tbl;
-  stream << *block._levelshifter_tbl;
-  stream << *block._group_tbl;
-  stream << *block.ap_tbl_;
-  stream << *block.global_connect_tbl_;
-  stream << *block._guide_tbl;
-  stream << *block._net_tracks_tbl;
-  stream << *block._box_tbl;
-  stream << *block._via_tbl;
-  stream << *block._gcell_grid_tbl;
-  stream << *block._track_grid_tbl;
-  stream << *block._obstruction_tbl;
-  stream << *block._blockage_tbl;
-  stream << *block._wire_tbl;
-  stream << *block._swire_tbl;
-  stream << *block._sbox_tbl;
-  stream << *block._row_tbl;
-  stream << *block._fill_tbl;
-  stream << *block._region_tbl;
-  stream << *block._hier_tbl;
-  stream << *block._bpin_tbl;
-  stream << *block._non_default_rule_tbl;
-  stream << *block._layer_rule_tbl;
-  stream << *block._prop_tbl;
-
-  stream << *block._name_cache;
-  stream << *block._r_val_tbl;
-  stream << *block._c_val_tbl;
-  stream << *block._cc_val_tbl;
-  stream << NamedTable("cap_node_tbl", block._cap_node_tbl);
-  stream << NamedTable("r_seg_tbl", block._r_seg_tbl);
-  stream << NamedTable("cc_seg_tbl", block._cc_seg_tbl);
+    tables.emplace_back([&](dbOStream& s) { s << *block._modbterm_tbl; });
+    tables.emplace_back([&](dbOStream& s) { s << *block._moditerm_tbl; });
+    tables.emplace_back([&](dbOStream& s) { s << *block._modnet_tbl; });
+  }
+  tables.emplace_back([&](dbOStream& s) { s << *block._powerdomain_tbl; });
+  tables.emplace_back([&](dbOStream& s) { s << *block._logicport_tbl; });
+  tables.emplace_back([&](dbOStream& s) { s << *block._powerswitch_tbl; });
+  tables.emplace_back([&](dbOStream& s) { s << *block._isolation_tbl; });
+  tables.emplace_back([&](dbOStream& s) { s << *block._levelshifter_tbl; });
+  tables.emplace_back([&](dbOStream& s) { s << *block._group_tbl; });
+  tables.emplace_back([&](dbOStream& s) { s << *block.ap_tbl_; });
+  tables.emplace_back([&](dbOStream& s) { s << *block.global_connect_tbl_; });
+  tables.emplace_back([&](dbOStream& s) { s << *block._guide_tbl; });
+  tables.emplace_back([&](dbOStream& s) { s << *block._net_tracks_tbl; });
+  tables.emplace_back([&](dbOStream& s) { s << *block._box_tbl; });
+  tables.emplace_back([&](dbOStream& s) { s << *block._via_tbl; });
+  tables.emplace_back([&](dbOStream& s) { s << *block._gcell_grid_tbl; });
+  tables.emplace_back([&](dbOStream& s) { s << *block._track_grid_tbl; });
+  tables.emplace_back([&](dbOStream& s) { s << *block._obstruction_tbl; });
+  tables.emplace_back([&](dbOStream& s) { s << *block._blockage_tbl; });
+  tables.emplace_back([&](dbOStream& s) { s << *block._wire_tbl; });
+  tables.emplace_back([&](dbOStream& s) { s << *block._swire_tbl; });
+  tables.emplace_back([&](dbOStream& s) { s << *block._sbox_tbl; });
+  tables.emplace_back([&](dbOStream& s) { s << *block._row_tbl; });
+  tables.emplace_back([&](dbOStream& s) { s << *block._fill_tbl; });
+  tables.emplace_back([&](dbOStream& s) { s << *block._region_tbl; });
+  tables.emplace_back([&](dbOStream& s) { s << *block._hier_tbl; });
+  tables.emplace_back([&](dbOStream& s) { s << *block._bpin_tbl; });
+  tables.emplace_back([&](dbOStream& s) { s << *block._non_default_rule_tbl; });
+  tables.emplace_back([&](dbOStream& s) { s << *block._layer_rule_tbl; });
+  tables.emplace_back([&](dbOStream& s) { s << *block._prop_tbl; });
+  tables.emplace_back([&](dbOStream& s) { s << *block._name_cache; });
+  tables.emplace_back([&](dbOStream& s) { s << *block._r_val_tbl; });
+  tables.emplace_back([&](dbOStream& s) { s << *block._c_val_tbl; });
+  tables.emplace_back([&](dbOStream& s) { s << *block._cc_val_tbl; });
+  tables.emplace_back([&](dbOStream& s) {
+    s << NamedTable("cap_node_tbl", block._cap_node_tbl);
+  });
+  tables.emplace_back(
+      [&](dbOStream& s) { s << NamedTable("r_seg_tbl", block._r_seg_tbl); });
+  tables.emplace_back(
+      [&](dbOStream& s) { s << NamedTable("cc_seg_tbl", block._cc_seg_tbl); });
+  writeTables(stream, tables);
   stream << *block._extControl;
   stream << block._dft;
   stream << *block._dft_tbl;
@@ -474,10 +474,11 @@ void dbDatabase::read(std::istream& file)
   stream >> *db;
 }
 
-void dbDatabase::write(std::ostream& file)
+void dbDatabase::write(std::ostream& file, int num_threads)
 {
   _dbDatabase* db = (_dbDatabase*) this;
   dbOStream stream(db, file);
+  stream.setNumThreads(num_threads);
   stream << *db;
   file.flush();
 }
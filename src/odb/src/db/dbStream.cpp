@@ -51,20 +51,50 @@ void dbOStream::popScope()
   if (logger->debugCheck(utl::ODB, "io_size", 1)) {
     auto size = pos() - _scopes.back().start_pos;
     if (size >= 1024) {  // hide tiny contributors
-      std::ostringstream scope_name;
-
-      std::transform(_scopes.begin(),
-                     _scopes.end(),
-                     std::ostream_iterator<std::string>(scope_name, "/"),
-                     [](const Scope& scope) { return scope.name; });
-
-      logger->report("{:8.1f} MB in {}", size / 1048576.0, scope_name.str());
+      const std::string report = fmt::format(
+          "{:8.1f} MB in {}", size / 1048576.0, getScopeName());
+      if (_io_size_reports != nullptr) {
+        _io_size_reports->push_back(report);
+      } else {
+        logger->report("{}", report);
+      }
     }
   }
 
   _scopes.pop_back();
 }
 
+std::string dbOStream::getScopeName() const
+{
+  std::string name = _parent_scope;
+  for (const Scope& scope : _scopes) {
+    name += scope.name;
+    name += '/';
+  }
+  return name;
+}
+
+void dbOStream::setParentScope(const dbOStream& parent,
+                               std::vector<std::string>* reports)
+{
+  _parent_scope = parent.getScopeName();
+  _io_size_reports = reports;
+}
+
+void dbOStream::writeBytes(std::streambuf* buf)
+{
+  // Inserting an empty streambuf sets failbit.
+  if (buf->sgetc() == std::char_traits<char>::eof()) {
+    return;
+  }
+  _f << buf;
+  // Insertion stops quietly when the output fails after some bytes went
+  // out, so report the short write the way ostream::write would.
+  if (buf->sgetc() != std::char_traits<char>::eof()) {
+    _f.setstate(std::ios::badbit);
+  }
+}
+
 dbOStream& operator<<(dbOStream& stream, const Rect& r)
 {
   stream << r.xlo_;
@@ -127,7 +157,8 @@ dbOStream::dbOStream(_dbDatabase* db, std::ostream& f) : _f(f)
   }
 }
 
-dbIStream::dbIStream(_dbDatabase* db, std::istream& f) : _f(f)
+dbIStream::dbIStream(_dbDatabase* db, std::istream& f)
+    : _f(f), _mapped(dynamic_cast<dbMappedFileBuf*>(f.rdbuf()))
 {
   _db = db;
 
@@ -33,6 +33,7 @@
 #include <fstream>
 #include <vector>
 
+#include "odb/dbMappedFile.h"
 #include "odb/defin.h"
 #include "odb/lefin.h"
 #include "odb/lefout.h"
@@ -165,13 +166,20 @@ odb::dbDatabase* read_db(odb::dbDatabase* db, const char* db_path)
     db = odb::dbDatabase::create();
   }
 
+  odb::dbMappedFileBuf mapped(db_path);
   std::ifstream file;
-  file.exceptions(std::ifstream::failbit | std::ifstream::badbit
-                  | std::ios::eofbit);
-  file.open(db_path, std::ios::binary);
+  std::istream stream(nullptr);
+  if (mapped.isOpen()) {
+    stream.rdbuf(&mapped);
+  } else {
+    file.open(db_path, std::ios::binary);
+    stream.rdbuf(file.rdbuf());
+  }
+  stream.exceptions(std::ifstream::failbit | std::ifstream::badbit
+                    | std::ios::eofbit);
 
   try {
-    db->read(file);
+    db->read(stream);
   } catch (const std::ios_base::failure& f) {
     auto msg = fmt::format("odb file {} is invalid: {}", db_path, f.what());
     throw std::ios_base::failure(msg);
@@ -0,0 +1,56 @@
+#define BOOST_TEST_MODULE TestMappedFile
+#include <boost/test/included/unit_test.hpp>
+#include <fstream>
+
+#include "env.h"
+#include "helper.h"
+#include "odb/db.h"
+#include "odb/dbMappedFile.h"
+
+namespace odb {
+namespace {
+
+BOOST_AUTO_TEST_SUITE(test_suite)
+
+BOOST_AUTO_TEST_CASE(test_read_mapped_db)
+{
+  dbDatabase* db = create2LevetDbWithBTerms();
+  std::string path = testTmpPath("results", "TestMappedFile.db");
+  {
+    std::ofstream write(path, std::ios::binary);
+    db->write(write);
+  }
+
+  dbMappedFileBuf mapped(path.c_str());
+  BOOST_TEST(mapped.isOpen());
+
+  std::istream read(&mapped);
+  read.exceptions(std::ifstream::failbit | std::ifstream::badbit
+                  | std::ios::eofbit);
+  dbDatabase* db2 = dbDatabase::create();
+  db2->read(read);
+
+  dbBlock* block = db->getChip()->getBlock();
+  dbBlock* block2 = db2->getChip()->getBlock();
+  BOOST_TEST(block2->getInsts().size() == block->getInsts().size());
+  BOOST_TEST(block2->getNets().size() == block->getNets().size());
+  BOOST_TEST(block2->getBTerms().size() == block->getBTerms().size());
+  BOOST_TEST(block2->findInst("i3") != nullptr);
+  BOOST_TEST(block2->findNet("n7") != nullptr);
+  // The whole mapping should have been consumed.
+  BOOST_TEST(read.tellg() == static_cast<std::streamoff>(mapped.size()));
+
+  dbDatabase::destroy(db);
+  dbDatabase::destroy(db2);
+}
+
+BOOST_AUTO_TEST_CASE(test_missing_file)
+{
+  dbMappedFileBuf mapped("no_such_file.db");
+  BOOST_TEST(!mapped.isOpen());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace
+}  // namespace odb
@@ -0,0 +1,74 @@
+#define BOOST_TEST_MODULE TestParallelWrite
+#include <boost/test/included/unit_test.hpp>
+#include <ios>
+#include <sstream>
+#include <streambuf>
+
+#include "helper.h"
+#include "odb/db.h"
+
+namespace odb {
+namespace {
+
+BOOST_AUTO_TEST_SUITE(test_suite)
+
+BOOST_AUTO_TEST_CASE(test_same_bytes)
+{
+  dbDatabase* db = create2LevetDbWithBTerms();
+
+  std::ostringstream serial;
+  db->write(serial);
+
+  std::ostringstream parallel;
+  db->write(parallel, 4);
+
+  BOOST_TEST(serial.str() == parallel.str());
+
+  dbDatabase::destroy(db);
+}
+
+// Accepts limit bytes and then fails every write, like a full disk.
+class FullBuf : public std::streambuf
+{
+ public:
+  explicit FullBuf(size_t limit) : limit_(limit) {}
+
+ protected:
+  int_type overflow(int_type c) override
+  {
+    if (size_ >= limit_) {
+      return traits_type::eof();
+    }
+    ++size_;
+    return traits_type::not_eof(c);
+  }
+
+ private:
+  size_t limit_;
+  size_t size_ = 0;
+};
+
+BOOST_AUTO_TEST_CASE(test_stream_failure)
+{
+  dbDatabase* db = create2LevetDbWithBTerms();
+
+  std::ostringstream serial;
+  db->write(serial);
+  const size_t size = serial.str().size();
+
+  // Fail at several points so that some land inside the block tables
+  // written by the worker threads.
+  for (size_t part = 0; part < 16; ++part) {
+    FullBuf buf(size * part / 16);
+    std::ostream out(&buf);
+    out.exceptions(std::ios::failbit | std::ios::badbit);
+    BOOST_CHECK_THROW(db->write(out, 4), std::ios_base::failure);
+  }
+
+  dbDatabase::destroy(db);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace
+}  // namespace odb
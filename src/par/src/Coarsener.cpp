@@ -40,9 +40,12 @@
 
 #include "Coarsener.h"
 
+#include <algorithm>
 #include <numeric>
 #include <random>
 #include <set>
+#include <thread>
+#include <unordered_map>
 
 #include "Evaluator.h"
 #include "Hypergraph.h"
@@ -52,6 +55,10 @@ using utl::PAR;
 
 namespace par {
 
+// Hyperedges per worker thread when mapping hyperedges to clusters in
+// Contraction; smaller hypergraphs are contracted on the calling thread.
+static constexpr int kMinHyperedgesPerThread = 50000;
+
 Coarsener::Coarsener(const int num_parts,
                      const int thr_coarsen_hyperedge_size_skip,
                      const int thr_coarsen_vertices,
@@ -327,6 +334,11 @@ void Coarsener::VertexMatching(
   const int num_early_stop_visited_vertices
       = static_cast<int>(unvisited.size()) / coarsening_ratio_;
   int num_visited_vertices = 0;
+  // dense score buffer shared by all vertices; only the entries listed in
+  // touched are valid and they are reset after each vertex
+  std::vector<float> score(hgraph->GetNumVertices(), 0.0);
+  std::vector<bool> scored(hgraph->GetNumVertices(), false);
+  std::vector<int> touched;
   for (auto v_iter = unvisited.begin(); v_iter != unvisited.end(); v_iter++) {
     const int v = *v_iter;  // here we should use iterator to enable early-stop
                             // mechanism
@@ -335,7 +347,11 @@ void Coarsener::VertexMatching(
     }
 
     // initialize the score for neighbors
-    std::map<int, float> score_map;
+    for (const int u : touched) {
+      score[u] = 0.0;
+      scored[u] = false;
+    }
+    touched.clear();
     // traverse all its neighbors
     for (const int he : hgraph->Edges(v)) {
       const auto edge_range = hgraph->Vertices(he);
@@ -351,8 +367,8 @@ void Coarsener::VertexMatching(
           continue;  // ignore the vertex v itself
         }
         // if the nbr_v has been identified
-        if (score_map.find(nbr_v) != score_map.end()) {
-          score_map[nbr_v] += he_score;
+        if (scored[nbr_v]) {
+          score[nbr_v] += he_score;
           continue;
         }
         // if the nbr_v is a new neighbor
@@ -375,12 +391,14 @@ void Coarsener::VertexMatching(
         if (hgraph->GetVertexWeights(v) + nbr_v_weight > thr_cluster_weight_) {
           continue;  // cannot satisfy the vertex weight constraint
         }
-        score_map[nbr_v] = he_score;
+        score[nbr_v] = he_score;
+        scored[nbr_v] = true;
+        touched.push_back(nbr_v);
       }
     }  // finish traversing all the neighbors
 
     // if there is no neighbor, map current vertex as a single-vertex cluster
-    if (score_map.empty()) {
+    if (touched.empty()) {
       num_visited_vertices++;
       vertex_cluster_id_vec[v] = cluster_id++;
       vertex_weights_c.push_back(hgraph->GetVertexWeights(v));
@@ -428,27 +446,30 @@ void Coarsener::VertexMatching(
           // If the neighbor not found by connectivity, which means the balance
           // constraint cannot be statisfied
           for (const auto& nbr_v : neighbors) {
-            if (score_map.find(nbr_v) != score_map.end()) {
-              score_map[nbr_v] += path_timing_score;
+            if (scored[nbr_v]) {
+              score[nbr_v] += path_timing_score;
             }
           }
         }  // finish traversing current paths
       }    // finish current nbr_v
     }
+    // visit the neighbors in increasing vertex id so that ties are broken
+    // the same way regardless of the traversal order
+    std::sort(touched.begin(), touched.end());
     // update the score based on physical location information
     if (hgraph->HasPlacement()) {
-      for (auto& [u, score] : score_map) {  // the score will be updated
-        score += evaluator_->GetPlacementScore(v, u, hgraph);
+      for (const int u : touched) {  // the score will be updated
+        score[u] += evaluator_->GetPlacementScore(v, u, hgraph);
       }
     }
     // find the best neighbor vertex
     float best_score = -std::numeric_limits<float>::max();
     int best_vertex = -1;
-    for (const auto& [u, score] : score_map) {
-      if (score > best_score) {
+    for (const int u : touched) {
+      if (score[u] > best_score) {
         best_vertex = u;
-        best_score = score;
-      } else if (score == best_score && vertex_cluster_id_vec[u] == -1) {
+        best_score = score[u];
+      } else if (score[u] == best_score && vertex_cluster_id_vec[u] == -1) {
         best_vertex = u;
       }
     }
@@ -757,28 +778,66 @@ HGraphPtr Coarsener::Contraction(
   std::vector<std::set<int>>
       hyperedge_arc_set_c;  // map current hyperedge into arcs in timing graph.
                             // We need this for propagation
-  std::map<size_t, int>
+  std::unordered_map<size_t, int>
       hash_map;  // store the hash value of each contracted hyperedge
-  std::map<size_t, std::vector<int>>
+  std::unordered_map<size_t, std::vector<int>>
       parallel_hash_map;  // store the hyperedges_c with the same hash_value
                           // (candidate)
-  for (int e = 0; e < hgraph->GetNumHyperedges(); e++) {
-    const auto range = hgraph->Vertices(e);
-    const int he_size = range.size();
-    if (he_size <= 1 || he_size > thr_coarsen_hyperedge_size_skip_) {
-      continue;  // ignore the single-vertex hyperedge and large hyperedge
+
+  // Map each hyperedge to its sorted list of distinct clusters.
+  // The hyperedges are independent, so the lists are computed in parallel
+  // into one flat array (hyperedge e owns the slots starting at
+  // cluster_offset[e]); parallel hyperedges are then merged serially below
+  // in hyperedge order.
+  const int num_hyperedges = hgraph->GetNumHyperedges();
+  std::vector<int> cluster_offset(num_hyperedges + 1, 0);
+  for (int e = 0; e < num_hyperedges; e++) {
+    cluster_offset[e + 1] = cluster_offset[e] + hgraph->Vertices(e).size();
+  }
+  std::vector<int> cluster_ind(cluster_offset.back());
+  std::vector<int> cluster_count(num_hyperedges, 0);
+  auto collect_clusters = [&](int first_e, int last_e) {
+    for (int e = first_e; e < last_e; e++) {
+      const auto range = hgraph->Vertices(e);
+      const int he_size = range.size();
+      if (he_size <= 1 || he_size > thr_coarsen_hyperedge_size_skip_) {
+        continue;  // ignore the single-vertex hyperedge and large hyperedge
+      }
+      int* clusters = cluster_ind.data() + cluster_offset[e];
+      int count = 0;
+      for (const int vertex_id : range) {
+        clusters[count++] = vertex_cluster_id_vec[vertex_id];  // cluster id
+      }
+      std::sort(clusters, clusters + count);
+      cluster_count[e] = std::unique(clusters, clusters + count) - clusters;
+    }
+  };
+  const int num_chunks
+      = std::min(static_cast<int>(std::thread::hardware_concurrency()),
+                 num_hyperedges / kMinHyperedgesPerThread);
+  if (num_chunks <= 1) {
+    collect_clusters(0, num_hyperedges);
+  } else {
+    std::vector<std::thread> threads;
+    threads.reserve(num_chunks);
+    for (int chunk = 0; chunk < num_chunks; chunk++) {
+      threads.emplace_back(collect_clusters,
+                           num_hyperedges * chunk / num_chunks,
+                           num_hyperedges * (chunk + 1) / num_chunks);
     }
-    std::set<int> hyperedge_c;
-    for (const int vertex_id : range) {
-      hyperedge_c.insert(vertex_cluster_id_vec[vertex_id]);  // get cluster id
+    for (auto& th : threads) {
+      th.join();
     }
-    if (hyperedge_c.size() <= 1) {
+  }
+
+  for (int e = 0; e < num_hyperedges; e++) {
+    const int* clusters_begin = cluster_ind.data() + cluster_offset[e];
+    const int* clusters_end = clusters_begin + cluster_count[e];
+    if (cluster_count[e] <= 1) {
       continue;  // ignore the single-vertex hyperedge
     }
-    size_t hash_value = std::inner_product(hyperedge_c.begin(),
-                                           hyperedge_c.end(),
-                                           hyperedge_c.begin(),
-                                           static_cast<size_t>(0));
+    size_t hash_value = std::inner_product(
+        clusters_begin, clusters_end, clusters_begin, static_cast<size_t>(0));
     // check if the hash value has been used
     // for detecting parallel hyperedge
     // hyperedge_slack_c[e] = min_slack(hyperedge_arc_set_c[e])
@@ -786,8 +845,7 @@ HGraphPtr Coarsener::Contraction(
       const int hyperedge_c_id = static_cast<int>(hyperedges_c.size());
       hyperedge_cluster_id_vec[e] = hyperedge_c_id;
       hash_map[hash_value] = hyperedge_c_id;
-      hyperedges_c.push_back(
-          std::vector<int>(hyperedge_c.begin(), hyperedge_c.end()));
+      hyperedges_c.emplace_back(clusters_begin, clusters_end);
       hyperedges_weights_c.push_back(hgraph->GetHyperedgeWeights(e));
       if (hgraph->HasTiming()) {
         hyperedge_slack_c.push_back(
@@ -801,7 +859,7 @@ HGraphPtr Coarsener::Contraction(
     // there may be parallel hyperedges
     const int hash_hyperedge_c_id
         = hash_map[hash_value];  // the hyperedge_c has been found
-    std::vector<int> hyperedge_vec(hyperedge_c.begin(), hyperedge_c.end());
+    std::vector<int> hyperedge_vec(clusters_begin, clusters_end);
     // check the representative hyperedge_c
     int parallel_hyperedge_c_id
         = -1;  // the hyperedge_c_id of parallel hyperedge
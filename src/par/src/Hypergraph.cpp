@@ -36,6 +36,7 @@
 #include "Hypergraph.h"
 
 #include <iostream>
+#include <numeric>
 #include <string>
 
 #include "Utilities.h"
@@ -66,6 +67,12 @@ Hypergraph::Hypergraph(
 {
   // add hyperedge
   // hyperedges: each hyperedge is a set of vertices
+  int num_pins = 0;
+  for (const auto& hyperedge : hyperedges) {
+    num_pins += static_cast<int>(hyperedge.size());
+  }
+  eind_.reserve(num_pins);
+  eptr_.reserve(num_hyperedges_ + 1);
   eptr_.push_back(0);
   for (const auto& hyperedge : hyperedges) {
     eind_.insert(eind_.end(), hyperedge.begin(), hyperedge.end());
@@ -73,20 +80,22 @@ Hypergraph::Hypergraph(
   }
 
   // add vertex
-  // create vertices from hyperedges
-  std::vector<std::vector<int>> vertices(num_vertices_);
+  // create vertices from hyperedges directly in CSR form:
+  // count the degree of each vertex, prefix-sum into vptr_, then scatter
+  // the hyperedge ids (in increasing order) into vind_
+  vptr_.assign(num_vertices_ + 1, 0);
+  for (const int v : eind_) {
+    vptr_[v + 1]++;
+  }
+  std::partial_sum(vptr_.begin(), vptr_.end(), vptr_.begin());
+  vind_.resize(eind_.size());
+  std::vector<int> fill_pos(vptr_.begin(), vptr_.end() - 1);
   for (int e = 0; e < num_hyperedges_; e++) {
-    for (auto v : hyperedges[e]) {
-      vertices[v].push_back(e);  // e is the hyperedge id
+    for (int idx = eptr_[e]; idx < eptr_[e + 1]; idx++) {
+      vind_[fill_pos[eind_[idx]]++] = e;  // e is the hyperedge id
     }
   }
 
-  vptr_.push_back(0);
-  for (const auto& vertex : vertices) {
-    vind_.insert(vind_.end(), vertex.begin(), vertex.end());
-    vptr_.push_back(static_cast<int>(vind_.size()));
-  }
-
   // fixed vertices
   fixed_vertex_flag_ = (fixed_attr.size() == num_vertices_);
   if (fixed_vertex_flag_) {
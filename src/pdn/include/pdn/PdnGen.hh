@@ -120,6 +120,7 @@ class PdnGen
 
   // Grids
   void buildGrids(bool trim);
+  void setThreads(int threads);
   std::vector<Grid*> findGrid(const std::string& name) const;
   void makeCoreGrid(VoltageDomain* domain,
                     const std::string& name,
@@ -233,6 +234,8 @@ class PdnGen
   odb::dbDatabase* db_;
   utl::Logger* logger_;
 
+  int threads_ = 1;
+
   std::unique_ptr<SRoute> sroute_;
   std::unique_ptr<PDNRenderer> debug_renderer_;
 
@@ -93,6 +93,11 @@ void PdnGen::resetShapes()
   updateRenderer();
 }
 
+void PdnGen::setThreads(int threads)
+{
+  threads_ = threads;
+}
+
 void PdnGen::buildGrids(bool trim)
 {
   debugPrint(logger_, utl::PDN, "Make", 1, "Build - begin");
@@ -105,6 +110,7 @@ void PdnGen::buildGrids(bool trim)
   // connect instances already assigned to grids
   std::set<odb::dbInst*> insts_in_grids;
   for (auto* grid : grids) {
+    grid->setThreads(threads_);
     auto insts_in_grid = grid->getInstances();
     insts_in_grids.insert(insts_in_grid.begin(), insts_in_grid.end());
   }
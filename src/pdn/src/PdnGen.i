@@ -36,6 +36,7 @@
 %{
 #include "pdn/PdnGen.hh"
 #include "odb/db.h"
+#include "ord/OpenRoad.hh"
 #include <array>
 #include <regex>
 #include <memory>
@@ -103,6 +104,7 @@ void reset_shapes()
 void build_grids(bool trim = true)
 {
   PdnGen* pdngen = ord::getPdnGen();
+  pdngen->setThreads(ord::OpenRoad::openRoad()->getThreadCount());
   pdngen->buildGrids(trim);
 }
 
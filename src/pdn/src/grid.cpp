@@ -501,7 +501,13 @@ void Grid::getIntersections(std::vector<ViaPtr>& shape_intersections,
   }
 
   // loop over connect statements
-  for (const auto& connect : connect_) {
+  // The connect statements are independent, so their intersections are
+  // searched in parallel and appended in connect order.
+  std::vector<std::vector<ViaPtr>> connect_intersections(connect_.size());
+#pragma omp parallel for num_threads(threads_) schedule(dynamic, 1)
+  for (int i = 0; i < connect_.size(); i++) {
+    const auto& connect = connect_[i];
+    auto& intersections = connect_intersections[i];
     odb::dbTechLayer* lower_layer = connect->getLowerLayer();
     odb::dbTechLayer* upper_layer = connect->getUpperLayer();
 
@@ -553,10 +559,14 @@ void Grid::getIntersections(std::vector<ViaPtr>& shape_intersections,
                             via_rect,
                             lower_shape,
                             upper_shape);
-        shape_intersections.push_back(ViaPtr(via));
+        intersections.push_back(ViaPtr(via));
       }
     }
   }
+  for (auto& intersections : connect_intersections) {
+    shape_intersections.insert(
+        shape_intersections.end(), intersections.begin(), intersections.end());
+  }
   debugPrint(getLogger(),
              utl::PDN,
              "Via",
@@ -733,18 +743,32 @@ void Grid::makeVias(const Shape::ShapeTreeMap& global_shapes,
 
   std::set<ViaPtr> remove_vias;
   // remove vias with obstructions in their stack
-  for (const auto& via : vias) {
+  // the obstruction searches only read the trees, so they run in parallel
+  // and the failed vias are marked afterwards in order
+  std::vector<char> obstructed(vias.size(), false);
+#pragma omp parallel for num_threads(threads_) schedule(dynamic, 1024)
+  for (int i = 0; i < vias.size(); i++) {
+    const auto& via = vias[i];
     for (auto* layer : via->getConnect()->getIntermediteLayers()) {
-      auto& search_obs = search_obstructions[layer];
+      auto search_obs_itr = search_obstructions.find(layer);
+      if (search_obs_itr == search_obstructions.end()) {
+        continue;
+      }
+      const auto& search_obs = search_obs_itr->second;
       if (search_obs.qbegin(bgi::intersects(via->getArea())
                             && bgi::satisfies(obs_filter))
           != search_obs.qend()) {
-        remove_vias.insert(via);
-        via->markFailed(failedViaReason::OBSTRUCTED);
+        obstructed[i] = true;
         break;
       }
     }
   }
+  for (int i = 0; i < vias.size(); i++) {
+    if (obstructed[i]) {
+      remove_vias.insert(vias[i]);
+      vias[i]->markFailed(failedViaReason::OBSTRUCTED);
+    }
+  }
   debugPrint(getLogger(),
              utl::PDN,
              "Via",
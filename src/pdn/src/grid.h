@@ -201,6 +201,9 @@ class Grid
   bool hasShapes() const;
   bool hasVias() const;
 
+  // number of threads used when searching for via intersections
+  void setThreads(int threads) { threads_ = threads; }
+
  protected:
   // find all intersections in the shapes which may become vias
   virtual void getIntersections(std::vector<ViaPtr>& intersections,
@@ -217,6 +220,8 @@ class Grid
 
   bool allow_repair_channels_ = false;
 
+  int threads_ = 1;
+
   std::vector<std::unique_ptr<Rings>> rings_;
   std::vector<std::unique_ptr<Straps>> straps_;
   std::vector<std::unique_ptr<Connect>> connect_;
@@ -512,6 +512,11 @@ DbVia::ViaLayerShape DbGenerateVia::generate(
     const std::set<odb::dbTechLayer*>& ongrid,
     utl::Logger* logger)
 {
+  if (via_ != nullptr && via_block_ == block) {
+    incrementCount();
+    return getLayerShapes(odb::dbSBox::create(wire, via_, x, y, type));
+  }
+
   const std::string via_name = getViaName();
   auto* via = block->findVia(via_name.c_str());
 
@@ -544,6 +549,8 @@ DbVia::ViaLayerShape DbGenerateVia::generate(
 
     via->setViaParams(params);
   }
+  via_block_ = block;
+  via_ = via;
 
   incrementCount();
   return getLayerShapes(odb::dbSBox::create(wire, via, x, y, type));
@@ -301,6 +301,10 @@ class DbGenerateVia : public DbBaseVia
   odb::dbTechLayer* cut_;
   odb::dbTechLayer* top_;
 
+  // via found or created by generate, reused for placements in the same block
+  odb::dbBlock* via_block_ = nullptr;
+  odb::dbVia* via_ = nullptr;
+
   std::string getViaName() const;
 };
 
@@ -59,6 +59,7 @@ class dbTechLayer;
 namespace ppl {
 class AbstractIOPlacerRenderer;
 class Core;
+class HungarianMatching;
 class Interval;
 class IOPin;
 class Netlist;
@@ -128,6 +129,7 @@ class IOPlacer
   void runAnnealing(bool random);
   void reportHPWL();
   void printConfig(bool annealing = false);
+  void setNumThreads(int num_threads) { num_threads_ = num_threads; }
   Parameters* getParameters() { return parms_.get(); }
   int64 computeIONetsHPWL();
   void excludeInterval(Edge edge, int begin, int end);
@@ -250,6 +252,7 @@ class IOPlacer
   int64 computeIONetsHPWL(Netlist* netlist);
   void findPinAssignment(std::vector<Section>& sections,
                          bool mirrored_groups_only);
+  void solveAssignments(std::vector<HungarianMatching>& hg_vec, bool groups);
   void updateSlots();
   void excludeInterval(Interval interval);
 
@@ -321,6 +324,9 @@ class IOPlacer
   int perturb_per_iter_ = 0;
   float alpha_ = 0;
 
+  // number of threads used to solve the sections' assignments
+  int num_threads_ = 1;
+
   // simulated annealing debugger variables
   bool annealing_debug_mode_ = false;
 
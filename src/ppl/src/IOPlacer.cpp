@@ -36,6 +36,7 @@
 #include "ppl/IOPlacer.h"
 
 #include <algorithm>
+#include <exception>
 #include <fstream>
 #include <random>
 #include <sstream>
@@ -2003,9 +2004,9 @@ void IOPlacer::findPinAssignment(std::vector<Section>& sections,
     }
   }
 
-  for (auto& match : hg_vec) {
-    match.findAssignmentForGroups();
-  }
+  // The sections share no slots, so their assignments are solved in
+  // parallel and committed in section order afterwards.
+  solveAssignments(hg_vec, true);
 
   for (auto& match : hg_vec) {
     match.getAssignmentForGroups(
@@ -2018,9 +2019,7 @@ void IOPlacer::findPinAssignment(std::vector<Section>& sections,
     updateSection(sec, slots);
   }
 
-  for (auto& match : hg_vec) {
-    match.findAssignment();
-  }
+  solveAssignments(hg_vec, false);
 
   if (!mirrored_pins_.empty()) {
     for (auto& match : hg_vec) {
@@ -2033,6 +2032,30 @@ void IOPlacer::findPinAssignment(std::vector<Section>& sections,
   }
 }
 
+void IOPlacer::solveAssignments(std::vector<HungarianMatching>& hg_vec,
+                                bool groups)
+{
+  std::exception_ptr exception;
+#pragma omp parallel for num_threads(num_threads_) schedule(dynamic, 1)
+  for (int i = 0; i < hg_vec.size(); i++) {
+    try {
+      if (groups) {
+        hg_vec[i].findAssignmentForGroups();
+      } else {
+        hg_vec[i].findAssignment();
+      }
+    } catch (...) {
+#pragma omp critical
+      if (!exception) {
+        exception = std::current_exception();
+      }
+    }
+  }
+  if (exception) {
+    std::rethrow_exception(exception);
+  }
+}
+
 void IOPlacer::updateSlots()
 {
   for (Slot& slot : slots_) {
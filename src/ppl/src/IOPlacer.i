@@ -232,6 +232,7 @@ add_pin_group(PinList *pin_list, bool order)
 void
 run_io_placement(bool randomMode)
 {
+  getIOPlacer()->setNumThreads(ord::OpenRoad::openRoad()->getThreadCount());
   getIOPlacer()->run(randomMode);
 }
 
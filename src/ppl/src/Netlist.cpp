@@ -130,27 +130,37 @@ Rect Netlist::getBB(int idx, const Point& slot_pos)
 }
 
 int Netlist::computeIONetHPWL(int idx, const Point& slot_pos)
+{
+  return computeIONetHPWL(getInstPinsBBox(idx), slot_pos);
+}
+
+int Netlist::computeIONetHPWL(const Rect& inst_pins_bbox,
+                              const Point& slot_pos)
+{
+  int min_x = std::min(inst_pins_bbox.xMin(), slot_pos.x());
+  int min_y = std::min(inst_pins_bbox.yMin(), slot_pos.y());
+  int max_x = std::max(inst_pins_bbox.xMax(), slot_pos.x());
+  int max_y = std::max(inst_pins_bbox.yMax(), slot_pos.y());
+
+  int x = max_x - min_x;
+  int y = max_y - min_y;
+
+  return (x + y);
+}
+
+Rect Netlist::getInstPinsBBox(int idx)
 {
   int net_start = net_pointer_[idx];
   int net_end = net_pointer_[idx + 1];
 
-  int min_x = slot_pos.x();
-  int min_y = slot_pos.y();
-  int max_x = slot_pos.x();
-  int max_y = slot_pos.y();
-
+  Rect bbox;
+  bbox.mergeInit();
   for (int idx = net_start; idx < net_end; ++idx) {
     Point pos = inst_pins_[idx].getPos();
-    min_x = std::min(min_x, pos.x());
-    max_x = std::max(max_x, pos.x());
-    min_y = std::min(min_y, pos.y());
-    max_y = std::max(max_y, pos.y());
+    bbox.merge(Rect(pos, pos));
   }
 
-  int x = max_x - min_x;
-  int y = max_y - min_y;
-
-  return (x + y);
+  return bbox;
 }
 
 int Netlist::computeDstIOtoPins(int idx, const Point& slot_pos)
@@ -201,6 +201,11 @@ class Netlist
   void getSinksOfIO(int idx, std::vector<InstancePin>& sinks);
 
   int computeIONetHPWL(int idx, const odb::Point& slot_pos);
+  // HPWL of an IO net given the bounding box of its instance pins
+  // (inverted when the net has no instance pins)
+  static int computeIONetHPWL(const odb::Rect& inst_pins_bbox,
+                              const odb::Point& slot_pos);
+  odb::Rect getInstPinsBBox(int idx);
   int computeDstIOtoPins(int idx, const odb::Point& slot_pos);
   void sortPinsFromGroup(int group_idx, Edge edge);
   odb::Rect getBB(int idx, const odb::Point& slot_pos);
@@ -195,6 +195,13 @@ void SimulatedAnnealing::init(float init_temperature,
   alpha_ = alpha != 0 ? alpha : alpha_;
 
   pin_assignment_.resize(num_pins_);
+  // the instance pins do not move during annealing, so the bounding box of
+  // each IO net without its IO pin is computed once and the pin cost only
+  // merges it with the pin's slot
+  inst_pins_bboxes_.resize(num_pins_);
+  for (int i = 0; i < num_pins_; i++) {
+    inst_pins_bboxes_[i] = netlist_->getInstPinsBBox(i);
+  }
   slot_indices_.resize(num_slots_);
   std::iota(slot_indices_.begin(), slot_indices_.end(), 0);
 
@@ -358,16 +365,14 @@ int SimulatedAnnealing::getPinCost(int pin_idx)
 {
   int slot_idx = pin_assignment_[pin_idx];
   const odb::Point& position = slots_[slot_idx].pos;
-  return netlist_->computeIONetHPWL(pin_idx, position);
+  return Netlist::computeIONetHPWL(inst_pins_bboxes_[pin_idx], position);
 }
 
 int64 SimulatedAnnealing::getGroupCost(int group_idx)
 {
   int64 cost = 0;
   for (int pin_idx : pin_groups_[group_idx].pin_indices) {
-    int slot_idx = pin_assignment_[pin_idx];
-    const odb::Point& position = slots_[slot_idx].pos;
-    cost += netlist_->computeIONetHPWL(pin_idx, position);
+    cost += getPinCost(pin_idx);
   }
 
   return cost;
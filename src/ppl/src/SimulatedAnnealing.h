@@ -128,6 +128,8 @@ class SimulatedAnnealing
 
   // [pin] -> slot
   std::vector<int> pin_assignment_;
+  // [pin] -> bounding box of the instance pins connected to the pin
+  std::vector<odb::Rect> inst_pins_bboxes_;
   std::vector<int> slot_indices_;
   Netlist* netlist_;
   Core* core_;
@@ -32,6 +32,7 @@
 
 #include "ir_solver.h"
 
+#include <Eigen/IterativeLinearSolvers>
 #include <Eigen/SparseLU>
 #include <fstream>
 #include <list>
@@ -865,9 +866,139 @@ void IRSolver::addSourcesToMatrixAndVoltages(
   }
 }
 
+Eigen::VectorXd IRSolver::solveIterative(
+    Voltage src_voltage,
+    const std::vector<std::unique_ptr<psm::SourceNode>>& sources,
+    const std::map<Node*, std::size_t>& node_index,
+    const Eigen::SparseMatrix<Connection::Conductance>& G,
+    const Eigen::VectorXd& J,
+    const ValueNodeMap<Voltage>& initial_voltages) const
+{
+  const utl::DebugScopedTimer timer(
+      logger_, utl::PSM, "timer", 1, "Iterative solve: {}");
+
+  using RowMatrix
+      = Eigen::SparseMatrix<Connection::Conductance, Eigen::RowMajor>;
+  // Relative residual |b - G*V| / |b|
+  constexpr double tolerance = 1e-10;
+
+  const std::size_t num_nodes = node_index.size();
+
+  // The sources are ideal voltage sources, so the nodes they attach to are
+  // known to be at src_voltage. Moving those nodes to the right hand side
+  // leaves a symmetric positive definite system for conjugate gradient.
+  std::vector<bool> fixed(num_nodes, false);
+  for (const auto& src_node : sources) {
+    fixed[node_index.at(src_node.get())] = true;
+    fixed[node_index.at(src_node->getSource())] = true;
+  }
+
+  std::vector<Eigen::Index> reduced_index(num_nodes, -1);
+  Eigen::Index num_free = 0;
+  for (std::size_t i = 0; i < num_nodes; i++) {
+    if (!fixed[i]) {
+      reduced_index[i] = num_free++;
+    }
+  }
+
+  Eigen::VectorXd b(num_free);
+  for (std::size_t i = 0; i < num_nodes; i++) {
+    if (reduced_index[i] >= 0) {
+      b[reduced_index[i]] = J[i];
+    }
+  }
+
+  std::vector<Eigen::Triplet<Connection::Conductance>> cond_values;
+  cond_values.reserve(G.nonZeros());
+  for (Eigen::Index k = 0; k < G.outerSize(); k++) {
+    for (Eigen::SparseMatrix<Connection::Conductance>::InnerIterator it(G, k);
+         it;
+         ++it) {
+      const Eigen::Index row = reduced_index[it.row()];
+      if (row < 0) {
+        continue;
+      }
+      const Eigen::Index col = reduced_index[it.col()];
+      if (col < 0) {
+        b[row] -= it.value() * src_voltage;
+      } else {
+        cond_values.emplace_back(row, col, it.value());
+      }
+    }
+  }
+  RowMatrix G_free(num_free, num_free);
+  G_free.setFromTriplets(cond_values.begin(), cond_values.end());
+  cond_values.clear();
+
+  // Warm start from the previous solution when there is one, otherwise
+  // from the source voltage, which is close since IR drop is small.
+  Eigen::VectorXd guess(num_free);
+  for (const auto& [node, idx] : node_index) {
+    const Eigen::Index row = reduced_index[idx];
+    if (row < 0) {
+      continue;
+    }
+    auto find_node = initial_voltages.find(node);
+    if (find_node == initial_voltages.end()) {
+      guess[row] = src_voltage;
+    } else {
+      guess[row] = find_node->second;
+    }
+  }
+
+  // Lower|Upper lets Eigen use its multithreaded sparse matrix-vector
+  // product.
+  Eigen::ConjugateGradient<RowMatrix,
+                           Eigen::Lower | Eigen::Upper,
+                           Eigen::IncompleteCholesky<Connection::Conductance>>
+      cg;
+  cg.setTolerance(tolerance);
+
+  debugPrint(logger_, utl::PSM, "solve", 1, "Preconditioning the G matrix");
+  cg.compute(G_free);
+  if (cg.info() != Eigen::ComputationInfo::Success) {
+    logger_->error(utl::PSM,
+                   93,
+                   "Incomplete Cholesky preconditioning of the G matrix "
+                   "failed.");
+  }
+
+  debugPrint(
+      logger_, utl::PSM, "solve", 1, "Solving system of equations GV=J (CG)");
+  const Eigen::VectorXd V_free = cg.solveWithGuess(b, guess);
+  if (cg.info() != Eigen::ComputationInfo::Success) {
+    logger_->error(utl::PSM,
+                   94,
+                   "Conjugate gradient did not converge after {} iterations "
+                   "(error {:.3e}).",
+                   cg.iterations(),
+                   cg.error());
+  }
+  debugPrint(logger_,
+             utl::PSM,
+             "solve",
+             1,
+             "Conjugate gradient converged in {} iterations (error {:.3e})",
+             cg.iterations(),
+             cg.error());
+
+  // Source node entries hold the source currents in the direct solve and are
+  // not used, so only the real nodes are filled in.
+  Eigen::VectorXd V = Eigen::VectorXd::Zero(num_nodes);
+  for (std::size_t i = 0; i < num_nodes; i++) {
+    if (reduced_index[i] >= 0) {
+      V[i] = V_free[reduced_index[i]];
+    } else {
+      V[i] = src_voltage;
+    }
+  }
+  return V;
+}
+
 void IRSolver::solve(sta::Corner* corner,
                      GeneratedSourceType source_type,
-                     const std::string& source_file)
+                     const std::string& source_file,
+                     bool use_iterative_solver)
 {
   const utl::DebugScopedTimer timer(logger_, utl::PSM, "timer", 1, "Solve: {}");
 
@@ -880,6 +1011,19 @@ void IRSolver::solve(sta::Corner* corner,
   auto& voltages = voltages_[corner];
   auto& currents = currents_[corner];
 
+  // Keep the last solution of this corner (or of any solved corner) as the
+  // starting point of the iterative solver.
+  ValueNodeMap<Voltage> initial_voltages;
+  if (use_iterative_solver) {
+    initial_voltages = voltages;
+    for (const auto& [solved_corner, solved_voltages] : voltages_) {
+      if (!initial_voltages.empty()) {
+        break;
+      }
+      initial_voltages = solved_voltages;
+    }
+  }
+
   voltages.clear();
   currents.clear();
 
@@ -938,41 +1082,49 @@ void IRSolver::solve(sta::Corner* corner,
                              node_index,
                              G,
                              J);
-  addSourcesToMatrixAndVoltages(src_voltage, src_nodes, node_index, G, J);
-
-  Eigen::SparseLU<Eigen::SparseMatrix<Connection::Conductance>> eigen_solver;
-
-  debugPrint(logger_, utl::PSM, "solve", 1, "Factorizing the G matrix");
-  eigen_solver.compute(G);
-  if (eigen_solver.info() != Eigen::ComputationInfo::Success) {
-    // decomposition failed
-    if (logger_->debugCheck(utl::PSM, "dump", 1)) {
-      network_->dumpNodes(node_index);
-      dumpMatrix(G, "G");
+  Eigen::VectorXd V;
+  if (use_iterative_solver) {
+    V = solveIterative(
+        src_voltage, src_nodes, node_index, G, J, initial_voltages);
+  } else {
+    addSourcesToMatrixAndVoltages(src_voltage, src_nodes, node_index, G, J);
+
+    Eigen::SparseLU<Eigen::SparseMatrix<Connection::Conductance>>
+        eigen_solver;
+
+    debugPrint(logger_, utl::PSM, "solve", 1, "Factorizing the G matrix");
+    eigen_solver.compute(G);
+    if (eigen_solver.info() != Eigen::ComputationInfo::Success) {
+      // decomposition failed
+      if (logger_->debugCheck(utl::PSM, "dump", 1)) {
+        network_->dumpNodes(node_index);
+        dumpMatrix(G, "G");
+      }
+      logger_->error(utl::PSM,
+                     10,
+                     "LU factorization of the G Matrix failed. SparseLU solver "
+                     "message: {}.",
+                     eigen_solver.lastErrorMessage());
     }
-    logger_->error(
-        utl::PSM,
-        10,
-        "LU factorization of the G Matrix failed. SparseLU solver message: {}.",
-        eigen_solver.lastErrorMessage());
-  }
-
-  debugPrint(logger_, utl::PSM, "solve", 1, "Solving system of equations GV=J");
-  const Eigen::VectorXd V = eigen_solver.solve(J);
-  if (eigen_solver.info() != Eigen::ComputationInfo::Success) {
-    // solving failed
-    if (logger_->debugCheck(utl::PSM, "dump", 1)) {
-      network_->dumpNodes(node_index);
-      dumpMatrix(G, "G");
-      dumpVector(J, "J");
+
+    debugPrint(
+        logger_, utl::PSM, "solve", 1, "Solving system of equations GV=J");
+    V = eigen_solver.solve(J);
+    if (eigen_solver.info() != Eigen::ComputationInfo::Success) {
+      // solving failed
+      if (logger_->debugCheck(utl::PSM, "dump", 1)) {
+        network_->dumpNodes(node_index);
+        dumpMatrix(G, "G");
+        dumpVector(J, "J");
+      }
+      logger_->error(utl::PSM, 12, "Solving V = inv(G)*J failed.");
     }
-    logger_->error(utl::PSM, 12, "Solving V = inv(G)*J failed.");
+    debugPrint(logger_,
+               utl::PSM,
+               "solve",
+               1,
+               "Solving system of equations GV=J complete");
   }
-  debugPrint(logger_,
-             utl::PSM,
-             "solve",
-             1,
-             "Solving system of equations GV=J complete");
 
   if (logger_->debugCheck(utl::PSM, "dump", 2)) {
     network_->dumpNodes(node_index);
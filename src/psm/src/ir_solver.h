@@ -102,7 +102,8 @@ class IRSolver
 
   void solve(sta::Corner* corner,
              GeneratedSourceType source_type,
-             const std::string& source_file);
+             const std::string& source_file,
+             bool use_iterative_solver = false);
 
   void report(sta::Corner* corner) const;
   void reportEM(sta::Corner* corner) const;
@@ -212,6 +213,14 @@ class IRSolver
       Eigen::SparseMatrix<Connection::Conductance>& G,
       Eigen::VectorXd& J) const;
 
+  Eigen::VectorXd solveIterative(
+      Voltage src_voltage,
+      const std::vector<std::unique_ptr<psm::SourceNode>>& sources,
+      const std::map<Node*, std::size_t>& node_index,
+      const Eigen::SparseMatrix<Connection::Conductance>& G,
+      const Eigen::VectorXd& J,
+      const ValueNodeMap<Voltage>& initial_voltages) const;
+
   std::string getMetricKey(const std::string& key, sta::Corner* corner) const;
 
   void dumpVector(const Eigen::VectorXd& vector, const std::string& name) const;
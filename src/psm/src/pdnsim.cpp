@@ -96,14 +96,16 @@ void PDNSim::analyzePowerGrid(odb::dbNet* net,
                               bool enable_em,
                               const std::string& em_file,
                               const std::string& error_file,
-                              const std::string& voltage_source_file)
+                              const std::string& voltage_source_file,
+                              bool use_iterative_solver)
 {
   if (!checkConnectivity(net, false, error_file)) {
     return;
   }
 
   auto* solver = getIRSolver(net, false);
-  solver->solve(corner, source_type, voltage_source_file);
+  solver->solve(
+      corner, source_type, voltage_source_file, use_iterative_solver);
   solver->report(corner);
 
   heatmap_->setNet(net);
@@ -43,7 +43,8 @@ def analyze_power_grid(design, *,
                        enable_em=False,
                        em_outfile=None,
                        net=None,
-                       corner=None):
+                       corner=None,
+                       use_iterative_solver=False):
     pdnsim = design.getPDNSim()
 
     if not net:
@@ -76,7 +77,8 @@ def analyze_power_grid(design, *,
                             enable_em,
                             em_outfile,
                             error_file,
-                            vsrc)
+                            vsrc,
+                            use_iterative_solver)
 
 
 def check_power_grid(design, *, net=None, error_file=None):
@@ -32,7 +32,9 @@
 
 #pragma once
 
+#include <limits>
 #include <map>
+#include <vector>
 
 #include "ext2dBox.h"
 #include "extprocess.h"
@@ -1335,14 +1337,25 @@ class extMain
                     odb::Rect& maxRectGs,
                     bool* hasSdbWires,
                     bool& hasGsWires);
-  uint addNetShapesGs(odb::dbNet* net,
-                      bool gsRotated,
-                      bool swap_coords,
-                      int dir);
-  uint addNetSboxesGs(odb::dbNet* net,
-                      bool gsRotated,
-                      bool swap_coords,
-                      int dir);
+  // A wire or power shape to be painted on _geomSeq by fill_gs4
+  struct GsShape
+  {
+    odb::Rect box;
+    uint level;
+  };
+  // The shapes fill_gs4 painted for the last band [lo, hi]: active holds
+  // the indices of the ones that reach it, in order, and next is the first
+  // shape that starts above it.
+  struct GsShapeCursor
+  {
+    std::vector<int> active;
+    size_t next = 0;
+    int lo = std::numeric_limits<int>::min();
+    int hi = std::numeric_limits<int>::min();
+  };
+  void addNetShapesGs(odb::dbNet* net, int dir, std::vector<GsShape>& shapes);
+  void addNetSboxesGs(odb::dbNet* net, int dir, std::vector<GsShape>& shapes);
+  void collectGsShapes(int dir, std::vector<GsShape>& shapes);
 
   uint getBucketNum(int base, int max, uint step, int xy);
   int getXY_gs(int base, int XY, uint minRes);
@@ -1640,6 +1653,10 @@ class extMain
                     bool gsRotated,
                     bool swap_coords,
                     int dir);
+  uint addBoxOnGS(const odb::Rect& r,
+                  uint level,
+                  bool gsRotated,
+                  bool swap_coords);
 
   uint fill_gs4(int dir,
                 int* ll,
@@ -1649,7 +1666,9 @@ class extMain
                 uint layerCnt,
                 uint* dirTable,
                 uint* pitchTable,
-                uint* widthTable);
+                uint* widthTable,
+                const std::vector<GsShape>& shapes,
+                GsShapeCursor& cursor);
 
   uint addInsts(uint dir,
                 int* lo_gs,
@@ -30,6 +30,7 @@
 // ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
 // POSSIBILITY OF SUCH DAMAGE.
 
+#include <algorithm>
 #include <map>
 #include <vector>
 
@@ -946,7 +947,14 @@ uint extMain::addShapeOnGS(dbNet* net,
     }
   }
 
-  uint level = layer->getRoutingLevel();
+  return addBoxOnGS(r, layer->getRoutingLevel(), gsRotated, swap_coords);
+}
+
+uint extMain::addBoxOnGS(const Rect& r,
+                         const uint level,
+                         const bool gsRotated,
+                         const bool swap_coords)
+{
   int n = 0;
   if (!gsRotated) {
     n = _geomSeq->box(r.xMin(), r.yMin(), r.xMax(), r.yMax(), level);
@@ -963,16 +971,13 @@ uint extMain::addShapeOnGS(dbNet* net,
   return 0;
 }
 
-uint extMain::addNetShapesGs(dbNet* net,
-                             bool gsRotated,
-                             bool swap_coords,
-                             int dir)
+void extMain::addNetShapesGs(dbNet* net,
+                             int dir,
+                             std::vector<GsShape>& shapes)
 {
-  bool USE_DB_UNITS = false;
-  uint cnt = 0;
   dbWire* wire = net->getWire();
   if (wire == nullptr) {
-    return 0;
+    return;
   }
 
   bool plane = false;
@@ -980,34 +985,25 @@ uint extMain::addNetShapesGs(dbNet* net,
     plane = true;
   }
 
-  dbWireShapeItr shapes;
+  dbWireShapeItr shape_itr;
   dbShape s;
-  for (shapes.begin(wire); shapes.next(s);) {
+  for (shape_itr.begin(wire); shape_itr.next(s);) {
     if (s.isVia()) {
       continue;
     }
 
-    int shapeId = shapes.getShapeId();
-
     Rect r = s.getBox();
-
-    if (USE_DB_UNITS) {
-      this->GetDBcoords2(r);
+    if (!plane && matchDir(dir, r)) {
+      continue;
     }
-
-    cnt += addShapeOnGS(
-        net, shapeId, r, plane, s.getTechLayer(), gsRotated, swap_coords, dir);
+    shapes.push_back({r, s.getTechLayer()->getRoutingLevel()});
   }
-  return cnt;
 }
 
-uint extMain::addNetSboxesGs(dbNet* net,
-                             bool gsRotated,
-                             bool swap_coords,
-                             int dir)
+void extMain::addNetSboxesGs(dbNet* net,
+                             int dir,
+                             std::vector<GsShape>& shapes)
 {
-  uint cnt = 0;
-
   dbSet<dbSWire> swires = net->getSWires();
   dbSet<dbSWire>::iterator itr;
 
@@ -1023,18 +1019,33 @@ uint extMain::addNetSboxesGs(dbNet* net,
         continue;
       }
 
-      Rect r = s->getBox();
-      cnt += addShapeOnGS(nullptr,
-                          s->getId(),
-                          r,
-                          true,
-                          s->getTechLayer(),
-                          gsRotated,
-                          swap_coords,
-                          dir);
+      shapes.push_back({s->getBox(), s->getTechLayer()->getRoutingLevel()});
     }
   }
-  return cnt;
+}
+
+// The shapes painted on the gs planes do not change from band to band, so
+// they are decoded from the db once per direction and sorted by their low
+// edge along dir. Shapes the direction filter drops are not kept.
+void extMain::collectGsShapes(int dir, std::vector<GsShape>& shapes)
+{
+  shapes.clear();
+  for (dbNet* net : _block->getNets()) {
+    if (net->getSigType().isSupply()) {
+      addNetSboxesGs(net, dir, shapes);
+    }
+  }
+  for (dbNet* net : _block->getNets()) {
+    if (!net->getSigType().isSupply()) {
+      addNetShapesGs(net, dir, shapes);
+    }
+  }
+  std::stable_sort(shapes.begin(),
+                   shapes.end(),
+                   [dir](const GsShape& a, const GsShape& b) {
+                     return (dir ? a.box.yMin() : a.box.xMin())
+                            < (dir ? b.box.yMin() : b.box.xMin());
+                   });
 }
 
 int extMain::getXY_gs(int base, int XY, uint minRes)
@@ -1122,41 +1133,62 @@ uint extMain::fill_gs4(int dir,
                        uint layerCnt,
                        uint* dirTable,
                        uint* pitchTable,
-                       uint* widthTable)
+                       uint* widthTable,
+                       const std::vector<GsShape>& shapes,
+                       GsShapeCursor& cursor)
 {
   bool rotatedGs = getRotatedFlag();
 
   initPlanes(dir, lo_gs, hi_gs, layerCnt, pitchTable, widthTable, dirTable, ll);
 
-  const int gs_dir = dir;
-
-  uint pcnt = 0;
-  dbSet<dbNet> nets = _block->getNets();
-  dbSet<dbNet>::iterator net_itr;
-
-  for (net_itr = nets.begin(); net_itr != nets.end(); ++net_itr) {
-    dbNet* net = *net_itr;
-
-    if (!((net->getSigType().isSupply()))) {
-      continue;
-    }
-
-    pcnt += addNetSboxesGs(net, rotatedGs, !dir, gs_dir);
+  // initPlanes snaps the low edge of each plane down by at most one
+  // pitch/width, so any shape ending before lo - maxRes or starting after hi
+  // would be clipped away by gs::box anyway.
+  int maxRes = 0;
+  for (uint ii = 1; ii < layerCnt; ii++) {
+    maxRes = std::max(maxRes, (int) std::max(pitchTable[ii], widthTable[ii]));
   }
-
-  uint scnt = 0;
-
-  for (net_itr = nets.begin(); net_itr != nets.end(); ++net_itr) {
-    dbNet* net = *net_itr;
-
-    if ((net->getSigType().isSupply())) {
-      continue;
+  const int lo = lo_gs[dir] - maxRes;
+  const int hi = hi_gs[dir];
+
+  auto low_edge = [dir](const GsShape& shape) {
+    return dir ? shape.box.yMin() : shape.box.xMin();
+  };
+  auto high_edge = [dir](const GsShape& shape) {
+    return dir ? shape.box.yMax() : shape.box.xMax();
+  };
+
+  // Bands normally only move up; if one moves down, the cursor no longer
+  // describes it and is rebuilt from the first shape.
+  if (lo < cursor.lo || hi < cursor.hi) {
+    cursor.active.clear();
+    cursor.next = 0;
+  }
+  cursor.lo = lo;
+  cursor.hi = hi;
+
+  // Retire the shapes that end below this band and add the ones that
+  // start in it, so each shape is visited only by the bands it reaches.
+  // Both keep active in shape order.
+  cursor.active.erase(std::remove_if(cursor.active.begin(),
+                                     cursor.active.end(),
+                                     [&](const int idx) {
+                                       return high_edge(shapes[idx]) < lo;
+                                     }),
+                      cursor.active.end());
+  for (; cursor.next < shapes.size() && low_edge(shapes[cursor.next]) <= hi;
+       cursor.next++) {
+    if (high_edge(shapes[cursor.next]) >= lo) {
+      cursor.active.push_back(static_cast<int>(cursor.next));
     }
+  }
 
-    scnt += addNetShapesGs(net, rotatedGs, !dir, gs_dir);
+  uint cnt = 0;
+  for (const int idx : cursor.active) {
+    cnt += addBoxOnGS(shapes[idx].box, shapes[idx].level, rotatedGs, !dir);
   }
 
-  return pcnt + scnt;
+  return cnt;
 }
 
 uint extMain::couplingFlow(Rect& extRect,
@@ -1246,6 +1278,7 @@ uint extMain::couplingFlow(Rect& extRect,
   // _use_signal_tables
   Ath__array1D<uint> sdbPowerTable;
   Ath__array1D<uint> tmpNetIdTable(64000);
+  std::vector<GsShape> gsShapes;
 
   uint totalWiresExtracted = 0;
 
@@ -1280,6 +1313,9 @@ uint extMain::couplingFlow(Rect& extRect,
 
     _search->initCouplingCapLoops(dir, ccFlag, coupleAndCompute, m);
 
+    collectGsShapes(dir, gsShapes);
+    GsShapeCursor gsCursor;
+
     lo_sdb[dir] = ll[dir] - step_nm[dir];
     int hiXY = ll[dir] + step_nm[dir];
     if (hiXY > ur[dir]) {
@@ -1303,7 +1339,9 @@ uint extMain::couplingFlow(Rect& extRect,
                layerCnt,
                dirTable,
                pitchTable,
-               widthTable);
+               widthTable,
+               gsShapes,
+               gsCursor);
 
       m->_rotatedGs = getRotatedFlag();
       m->_pixelTable = _geomSeq;
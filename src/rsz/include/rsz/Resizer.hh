@@ -38,10 +38,12 @@
 #include <array>
 #include <optional>
 #include <string>
+#include <unordered_set>
 
 #include "db_sta/dbSta.hh"
 #include "dpl/Opendp.h"
 #include "sta/Path.hh"
+#include "sta/PathRef.hh"
 #include "sta/UnorderedSet.hh"
 #include "utl/Logger.h"
 
@@ -52,7 +54,9 @@ class IncrementalGRoute;
 
 namespace stt {
 class SteinerTreeBuilder;
-}
+struct Tree;
+struct SteinerNet;
+}  // namespace stt
 
 namespace rsz {
 
@@ -102,6 +106,7 @@ using sta::Parasitic;
 using sta::ParasiticAnalysisPt;
 using sta::ParasiticNode;
 using sta::Parasitics;
+using sta::PathRef;
 using sta::Pin;
 using sta::PinSeq;
 using sta::PinSet;
@@ -265,7 +270,8 @@ class Resizer : public dbStaState
                    int max_passes,
                    bool verbose,
                    bool skip_pin_swap,
-                   bool skip_gate_cloning);
+                   bool skip_gate_cloning,
+                   int speculative_batch_size);
   // For testing.
   void repairSetup(const Pin* end_pin);
   // For testing.
@@ -282,7 +288,8 @@ class Resizer : public dbStaState
                   // Max buffer count as percent of design instance count.
                   float max_buffer_percent,
                   int max_passes,
-                  bool verbose);
+                  bool verbose,
+                  int speculative_batch_size);
   void repairHold(const Pin* end_pin,
                   double setup_margin,
                   double hold_margin,
@@ -532,7 +539,9 @@ class Resizer : public dbStaState
   void updateParasitics(bool save_guides = false);
   void ensureWireParasitic(const Pin* drvr_pin);
   void ensureWireParasitic(const Pin* drvr_pin, const Net* net);
+  bool needsWireParasitic(const Pin* drvr_pin, const Net* net);
   void estimateWireParasiticSteiner(const Pin* drvr_pin, const Net* net);
+  void makeWireParasitic(const Net* net, SteinerTree* tree);
   float totalLoad(SteinerTree* tree) const;
   float subtreeLoad(SteinerTree* tree,
                     float cap_per_micron,
@@ -568,6 +577,11 @@ class Resizer : public dbStaState
                               bool revisiting_inst);
   // Returns nullptr if net has less than 2 pins or any pin is not placed.
   SteinerTree* makeSteinerTree(const Pin* drvr_pin);
+  // First half of makeSteinerTree: collect the pins and fill in the flute
+  // input. Returns nullptr where makeSteinerTree would.
+  SteinerTree* initSteinerTree(const Pin* drvr_pin, stt::SteinerNet& stt_net);
+  // Second half of makeSteinerTree, once the flute tree is built.
+  void finishSteinerTree(SteinerTree* tree, const stt::Tree& ftree);
   BufferedNetPtr makeBufferedNet(const Pin* drvr_pin, const Corner* corner);
   BufferedNetPtr makeBufferedNetSteiner(const Pin* drvr_pin,
                                         const Corner* corner);
@@ -599,6 +613,10 @@ class Resizer : public dbStaState
   void journalSwapPins(Instance* inst, LibertyPort* port1, LibertyPort* port2);
   void journalInstReplaceCellBefore(Instance* inst);
   void journalMakeBuffer(Instance* buffer);
+  // Add the instances on path to claimed unless one of them is already
+  // claimed. Used to batch repairs of endpoints with disjoint paths.
+  bool claimPathInstances(PathRef& path,
+                          std::unordered_set<const Instance*>& claimed);
   Instance* journalCloneInstance(LibertyCell* cell,
                                  const char* name,
                                  Instance* original_inst,
@@ -693,6 +711,8 @@ class Resizer : public dbStaState
   static constexpr float tgt_slew_load_cap_factor = 10.0;
   // Prim/Dijkstra gets out of hand with bigger nets.
   static constexpr int max_steiner_pin_count_ = 200000;
+  // Nets whose Steiner trees are built together by estimateWireParasitics.
+  static constexpr int steiner_batch_size_ = 16384;
 
   friend class BufferedNet;
   friend class GateCloner;
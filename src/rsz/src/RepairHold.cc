@@ -90,7 +90,8 @@ void RepairHold::repairHold(
     // Max buffer count as percent of design instance count.
     const float max_buffer_percent,
     const int max_passes,
-    const bool verbose)
+    const bool verbose,
+    const int speculative_batch_size)
 {
   init();
   sta_->checkSlewLimitPreamble();
@@ -116,7 +117,8 @@ void RepairHold::repairHold(
              allow_setup_violations,
              max_buffer_count,
              max_passes,
-             verbose);
+             verbose,
+             speculative_batch_size);
 
   // Leave the parasitices up to date.
   resizer_->updateParasitics();
@@ -150,7 +152,8 @@ void RepairHold::repairHold(const Pin* end_pin,
              allow_setup_violations,
              max_buffer_count,
              max_passes,
-             false);
+             false,
+             0);
   // Leave the parasitices up to date.
   resizer_->updateParasitics();
   resizer_->incrementalParasiticsEnd();
@@ -243,7 +246,8 @@ void RepairHold::repairHold(VertexSeq& ends,
                             const bool allow_setup_violations,
                             const int max_buffer_count,
                             const int max_passes,
-                            const bool verbose)
+                            const bool verbose,
+                            const int speculative_batch_size)
 {
   // Find endpoints with hold violations.
   VertexSeq hold_failures;
@@ -280,7 +284,8 @@ void RepairHold::repairHold(VertexSeq& ends,
                      setup_margin,
                      hold_margin,
                      allow_setup_violations,
-                     max_buffer_count);
+                     max_buffer_count,
+                     speculative_batch_size);
       debugPrint(logger_,
                  RSZ,
                  "repair_hold",
@@ -352,30 +357,129 @@ void RepairHold::repairHoldPass(VertexSeq& hold_failures,
                                 const double setup_margin,
                                 const double hold_margin,
                                 const bool allow_setup_violations,
-                                const int max_buffer_count)
+                                const int max_buffer_count,
+                                const int speculative_batch_size)
 {
   resizer_->updateParasitics();
   sort(hold_failures, [=](Vertex* end1, Vertex* end2) {
     return sta_->vertexSlack(end1, min_) < sta_->vertexSlack(end2, min_);
   });
-  for (Vertex* end_vertex : hold_failures) {
+  VertexSeq deferred_ends;
+  VertexSeq* serial_ends = &hold_failures;
+  if (speculative_batch_size > 0) {
+    repairHoldSpeculative(hold_failures,
+                          buffer_cell,
+                          setup_margin,
+                          hold_margin,
+                          allow_setup_violations,
+                          max_buffer_count,
+                          speculative_batch_size,
+                          deferred_ends);
+    serial_ends = &deferred_ends;
+  }
+  for (Vertex* end_vertex : *serial_ends) {
     resizer_->updateParasitics();
     repairEndHold(end_vertex,
                   buffer_cell,
                   setup_margin,
                   hold_margin,
-                  allow_setup_violations);
+                  allow_setup_violations,
+                  nullptr);
     if (inserted_buffer_count_ > max_buffer_count) {
       break;
     }
   }
 }
 
+// Repair up to batch_size hold failures whose worst paths share no
+// instances before checking setup slack once for the whole batch instead
+// of after every buffer. A batch that pushes the worst setup slack below
+// the setup margin, or that slows down the slew of any buffered driver
+// more than a single buffer is allowed to, is rolled back and its
+// endpoints are returned in deferred_ends, along with endpoints that
+// overlap an earlier endpoint in their batch, to be repaired one at a time.
+void RepairHold::repairHoldSpeculative(VertexSeq& hold_failures,
+                                       LibertyCell* buffer_cell,
+                                       const double setup_margin,
+                                       const double hold_margin,
+                                       const bool allow_setup_violations,
+                                       const int max_buffer_count,
+                                       const int batch_size,
+                                       VertexSeq& deferred_ends)
+{
+  const int end_count = hold_failures.size();
+  int end_index = 0;
+  while (end_index < end_count && inserted_buffer_count_ <= max_buffer_count) {
+    resizer_->updateParasitics();
+    const Slack setup_slack_before = sta_->worstSlack(max_);
+
+    std::unordered_set<const Instance*> claimed;
+    VertexSeq batch_ends;
+    DrvrSlews batch_drvr_slews;
+    resizer_->journalBegin();
+    while (end_index < end_count && int(batch_ends.size()) < batch_size
+           && inserted_buffer_count_ <= max_buffer_count) {
+      Vertex* end_vertex = hold_failures[end_index++];
+      PathRef end_path = sta_->vertexWorstSlackPath(end_vertex, min_);
+      if (end_path.isNull()) {
+        continue;
+      }
+      if (!resizer_->claimPathInstances(end_path, claimed)) {
+        deferred_ends.push_back(end_vertex);
+        continue;
+      }
+      batch_ends.push_back(end_vertex);
+      repairEndHold(end_vertex,
+                    buffer_cell,
+                    setup_margin,
+                    hold_margin,
+                    allow_setup_violations,
+                    &batch_drvr_slews);
+    }
+
+    const Slack setup_slack_after = sta_->worstSlack(max_);
+    bool slew_degraded = false;
+    for (const auto& [drvr, slew_before] : batch_drvr_slews) {
+      const Slew slew_after = sta_->vertexSlew(drvr, max_);
+      if (slew_before > 0
+          && slew_after / slew_before > hold_buffer_slew_factor_max_) {
+        slew_degraded = true;
+        break;
+      }
+    }
+    const bool restore = slew_degraded
+                         || (!allow_setup_violations
+                             && fuzzyLess(setup_slack_after, setup_slack_before)
+                             && setup_slack_after < setup_margin);
+    debugPrint(logger_,
+               RSZ,
+               "repair_hold",
+               1,
+               "speculative batch ends {} setup slack {} -> {}{} {}",
+               batch_ends.size(),
+               delayAsString(setup_slack_before, sta_, 3),
+               delayAsString(setup_slack_after, sta_, 3),
+               slew_degraded ? " slew degraded" : "",
+               restore ? "restore" : "keep");
+    if (restore) {
+      resizer_->journalRestore(
+          resize_count_, inserted_buffer_count_, cloned_gate_count_);
+      deferred_ends.insert(
+          deferred_ends.end(), batch_ends.begin(), batch_ends.end());
+    }
+    resizer_->journalEnd();
+  }
+}
+
 void RepairHold::repairEndHold(Vertex* end_vertex,
                                LibertyCell* buffer_cell,
                                const double setup_margin,
                                const double hold_margin,
-                               const bool allow_setup_violations)
+                               const bool allow_setup_violations,
+                               // Null to back out buffers that hurt slew or
+                               // setup one at a time. Otherwise the caller
+                               // checks the returned driver slews and setup.
+                               DrvrSlews* batch_drvr_slews)
 {
   PathRef end_path = sta_->vertexWorstSlackPath(end_vertex, min_);
   if (!end_path.isNull()) {
@@ -468,6 +572,16 @@ void RepairHold::repairEndHold(Vertex* end_vertex,
               Point drvr_loc = db_network_->location(path_vertex->pin());
               Point buffer_loc((drvr_loc.x() + path_load_loc.x()) / 2,
                                (drvr_loc.y() + path_load_loc.y()) / 2);
+              if (batch_drvr_slews) {
+                batch_drvr_slews->emplace_back(
+                    path_vertex, sta_->vertexSlew(path_vertex, max_));
+                makeHoldDelay(path_vertex,
+                              load_pins,
+                              loads_have_out_port,
+                              buffer_cell,
+                              buffer_loc);
+                continue;
+              }
               // Despite checking for setup slack to insert the bufffer,
               // increased slews downstream can increase delays and
               // reduce setup slack in ways that are too expensive to
@@ -486,7 +600,7 @@ void RepairHold::repairEndHold(Vertex* end_vertex,
               float slew_factor
                   = (slew_before > 0) ? slew_after / slew_before : 1.0;
 
-              if (slew_factor > 1.20
+              if (slew_factor > hold_buffer_slew_factor_max_
                   || (!allow_setup_violations
                       && fuzzyLess(setup_slack_after, setup_slack_before)
                       && setup_slack_after < setup_margin)) {
@@ -57,6 +57,7 @@ using sta::Pin;
 using sta::PinSeq;
 using sta::RiseFall;
 using sta::Slack;
+using sta::Slew;
 using sta::StaState;
 using sta::Vertex;
 using sta::VertexSeq;
@@ -73,7 +74,8 @@ class RepairHold : public sta::dbStaState
                   // Max buffer count as percent of design instance count.
                   float max_buffer_percent,
                   int max_passes,
-                  bool verbose);
+                  bool verbose,
+                  int speculative_batch_size);
   void repairHold(const Pin* end_pin,
                   double setup_margin,
                   double hold_margin,
@@ -101,18 +103,32 @@ class RepairHold : public sta::dbStaState
                   bool allow_setup_violations,
                   int max_buffer_count,
                   int max_passes,
-                  bool verbose);
+                  bool verbose,
+                  int speculative_batch_size);
   void repairHoldPass(VertexSeq& hold_failures,
                       LibertyCell* buffer_cell,
                       double setup_margin,
                       double hold_margin,
                       bool allow_setup_violations,
-                      int max_buffer_count);
+                      int max_buffer_count,
+                      int speculative_batch_size);
+  void repairHoldSpeculative(VertexSeq& hold_failures,
+                             LibertyCell* buffer_cell,
+                             double setup_margin,
+                             double hold_margin,
+                             bool allow_setup_violations,
+                             int max_buffer_count,
+                             int batch_size,
+                             // Return value.
+                             VertexSeq& deferred_ends);
+  // Hold buffer drivers and their slews before the buffer was inserted.
+  using DrvrSlews = std::vector<std::pair<Vertex*, Slew>>;
   void repairEndHold(Vertex* end_vertex,
                      LibertyCell* buffer_cell,
                      double setup_margin,
                      double hold_margin,
-                     bool allow_setup_violations);
+                     bool allow_setup_violations,
+                     DrvrSlews* batch_drvr_slews);
   void makeHoldDelay(Vertex* drvr,
                      PinSeq& load_pins,
                      bool loads_have_out_port,
@@ -139,6 +155,8 @@ class RepairHold : public sta::dbStaState
   const int fall_index_ = RiseFall::fallIndex();
 
   static constexpr float hold_slack_limit_ratio_max_ = 0.2;
+  // Hold buffers that slow the driver slew down more than this are removed.
+  static constexpr float hold_buffer_slew_factor_max_ = 1.20;
   static constexpr int print_interval_ = 10;
 };
 
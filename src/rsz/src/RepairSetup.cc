@@ -35,6 +35,7 @@
 
 #include "RepairSetup.hh"
 
+#include <deque>
 #include <sstream>
 
 #include "rsz/Resizer.hh"
@@ -87,7 +88,8 @@ void RepairSetup::repairSetup(const float setup_slack_margin,
                               const int max_passes,
                               const bool verbose,
                               const bool skip_pin_swap,
-                              const bool skip_gate_cloning)
+                              const bool skip_gate_cloning,
+                              const int speculative_batch_size)
 {
   init();
   constexpr int digits = 3;
@@ -146,6 +148,14 @@ void RepairSetup::repairSetup(const float setup_slack_margin,
   if (verbose) {
     printProgress(print_iteration, false, false);
   }
+  if (speculative_batch_size > 0) {
+    repairSetupSpeculative(violating_ends,
+                           max_end_count,
+                           setup_slack_margin,
+                           speculative_batch_size,
+                           skip_pin_swap,
+                           skip_gate_cloning);
+  }
   for (const auto& end_original_slack : violating_ends) {
     Vertex* end = end_original_slack.first;
     resizer_->updateParasitics();
@@ -313,6 +323,113 @@ void RepairSetup::repairSetup(const float setup_slack_margin,
   }
 }
 
+// First pass over the violating endpoints that makes one repair move on
+// each of up to batch_size endpoints before updating timing. Endpoints
+// are batched only if their worst paths share no instances; an endpoint
+// that overlaps an earlier one in its batch is retried in a later batch.
+// A batch is kept if it improves the worst slack or the summed slack of
+// its endpoints without making the other worse, otherwise it is rolled
+// back. Endpoints are visited in violating_ends order so the result is
+// deterministic. The serial passes that follow pick up whatever is left.
+void RepairSetup::repairSetupSpeculative(
+    const vector<pair<Vertex*, Slack>>& violating_ends,
+    const int max_end_count,
+    const float setup_slack_margin,
+    const int batch_size,
+    const bool skip_pin_swap,
+    const bool skip_gate_cloning)
+{
+  constexpr int digits = 3;
+  const int end_count = std::min(max_end_count, int(violating_ends.size()));
+  int batch_count = 0;
+  int kept_batch_count = 0;
+  int end_index = 0;
+  // Endpoints that overlapped an earlier endpoint of their batch, oldest
+  // first. Every batch takes at least its first endpoint for good, so
+  // retrying these always terminates.
+  std::deque<Vertex*> pending_ends;
+  while ((end_index < end_count || !pending_ends.empty())
+         && !resizer_->overMaxArea()) {
+    resizer_->updateParasitics();
+    sta_->findRequireds();
+    const Slack prev_worst_slack = sta_->worstSlack(max_);
+
+    std::unordered_set<const sta::Instance*> claimed;
+    vector<Vertex*> batch_ends;
+    vector<Vertex*> overlap_ends;
+    Slack prev_batch_slack = 0.0;
+    resizer_->journalBegin();
+    while (int(batch_ends.size()) < batch_size) {
+      Vertex* end = nullptr;
+      if (!pending_ends.empty()) {
+        end = pending_ends.front();
+        pending_ends.pop_front();
+      } else if (end_index < end_count) {
+        end = violating_ends[end_index++].first;
+      } else {
+        break;
+      }
+      const Slack end_slack = sta_->vertexSlack(end, max_);
+      if (end_slack > setup_slack_margin) {
+        continue;
+      }
+      PathRef end_path = sta_->vertexWorstSlackPath(end, max_);
+      if (!resizer_->claimPathInstances(end_path, claimed)) {
+        overlap_ends.push_back(end);
+        continue;
+      }
+      if (repairPath(end_path, end_slack, skip_pin_swap, skip_gate_cloning)) {
+        batch_ends.push_back(end);
+        prev_batch_slack += end_slack;
+      }
+    }
+    pending_ends.insert(
+        pending_ends.begin(), overlap_ends.begin(), overlap_ends.end());
+    if (batch_ends.empty()) {
+      resizer_->journalEnd();
+      continue;
+    }
+
+    batch_count++;
+    resizer_->updateParasitics();
+    sta_->findRequireds();
+    const Slack worst_slack = sta_->worstSlack(max_);
+    Slack batch_slack = 0.0;
+    for (Vertex* end : batch_ends) {
+      batch_slack += sta_->vertexSlack(end, max_);
+    }
+    const bool keep = !fuzzyLess(worst_slack, prev_worst_slack)
+                      && !fuzzyLess(batch_slack, prev_batch_slack)
+                      && (fuzzyGreater(worst_slack, prev_worst_slack)
+                          || fuzzyGreater(batch_slack, prev_batch_slack));
+    debugPrint(logger_,
+               RSZ,
+               "repair_setup",
+               1,
+               "speculative batch {} ends {} batch slack {} -> {} worst slack "
+               "{} -> {} {}",
+               batch_count,
+               batch_ends.size(),
+               delayAsString(prev_batch_slack, sta_, digits),
+               delayAsString(batch_slack, sta_, digits),
+               delayAsString(prev_worst_slack, sta_, digits),
+               delayAsString(worst_slack, sta_, digits),
+               keep ? "keep" : "restore");
+    if (keep) {
+      kept_batch_count++;
+    } else {
+      resizer_->journalRestore(
+          resize_count_, inserted_buffer_count_, cloned_gate_count_);
+    }
+    resizer_->journalEnd();
+  }
+  logger_->info(RSZ,
+                150,
+                "Speculative repair kept {} of {} endpoint batches.",
+                kept_batch_count,
+                batch_count);
+}
+
 // For testing.
 void RepairSetup::repairSetup(const Pin* end_pin)
 {
@@ -89,7 +89,8 @@ class RepairSetup : public sta::dbStaState
                    int max_passes,
                    bool verbose,
                    bool skip_pin_swap,
-                   bool skip_gate_cloning);
+                   bool skip_gate_cloning,
+                   int speculative_batch_size);
   // For testing.
   void repairSetup(const Pin* end_pin);
   // For testing.
@@ -100,6 +101,13 @@ class RepairSetup : public sta::dbStaState
 
  private:
   void init();
+  void repairSetupSpeculative(
+      const vector<pair<Vertex*, Slack>>& violating_ends,
+      int max_end_count,
+      float setup_slack_margin,
+      int batch_size,
+      bool skip_pin_swap,
+      bool skip_gate_cloning);
   bool repairPath(PathRef& path,
                   Slack path_slack,
                   bool skip_pin_swap,
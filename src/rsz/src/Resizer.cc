@@ -58,6 +58,7 @@
 #include "sta/Liberty.hh"
 #include "sta/Network.hh"
 #include "sta/Parasitics.hh"
+#include "sta/PathExpanded.hh"
 #include "sta/PortDirection.hh"
 #include "sta/Sdc.hh"
 #include "sta/Search.hh"
@@ -2619,7 +2620,8 @@ void Resizer::repairSetup(double setup_margin,
                           int max_passes,
                           bool verbose,
                           bool skip_pin_swap,
-                          bool skip_gate_cloning)
+                          bool skip_gate_cloning,
+                          int speculative_batch_size)
 {
   resizePreamble();
   if (parasitics_src_ == ParasiticsSrc::global_routing) {
@@ -2630,7 +2632,8 @@ void Resizer::repairSetup(double setup_margin,
                              max_passes,
                              verbose,
                              skip_pin_swap,
-                             skip_gate_cloning);
+                             skip_gate_cloning,
+                             speculative_batch_size);
 }
 
 void Resizer::reportSwappablePins()
@@ -2660,7 +2663,8 @@ void Resizer::repairHold(
     // Max buffer count as percent of design instance count.
     float max_buffer_percent,
     int max_passes,
-    bool verbose)
+    bool verbose,
+    int speculative_batch_size)
 {
   resizePreamble();
   if (parasitics_src_ == ParasiticsSrc::global_routing) {
@@ -2671,7 +2675,8 @@ void Resizer::repairHold(
                            allow_setup_violations,
                            max_buffer_percent,
                            max_passes,
-                           verbose);
+                           verbose,
+                           speculative_batch_size);
 }
 
 void Resizer::repairHold(const Pin* end_pin,
@@ -2771,6 +2776,26 @@ void Resizer::journalMakeBuffer(Instance* buffer)
   inserted_buffer_set_.insert(buffer);
 }
 
+bool Resizer::claimPathInstances(PathRef& path,
+                                 std::unordered_set<const Instance*>& claimed)
+{
+  PathExpanded expanded(&path, sta_);
+  vector<const Instance*> insts;
+  const int path_length = expanded.size();
+  for (int i = expanded.startIndex(); i < path_length; i++) {
+    const Pin* pin = expanded.path(i)->pin(sta_);
+    if (!network_->isTopLevelPort(pin)) {
+      const Instance* inst = network_->instance(pin);
+      if (claimed.find(inst) != claimed.end()) {
+        return false;
+      }
+      insts.push_back(inst);
+    }
+  }
+  claimed.insert(insts.begin(), insts.end());
+  return true;
+}
+
 Instance* Resizer::journalCloneInstance(LibertyCell* cell,
                                         const char* name,
                                         Instance* original_inst,
@@ -515,6 +515,7 @@ sta::define_cmd_args "repair_timing" {[-setup] [-hold]\
                                         [-skip_pin_swap]\
                                         [-skip_gate_cloning]\
                                         [-repair_tns tns_end_percent]\
+                                        [-speculative_batch batch_size]\
                                         [-max_passes passes]\
                                         [-max_buffer_percent buffer_percent]\
                                         [-max_utilization util] \
@@ -524,7 +525,7 @@ proc repair_timing { args } {
   sta::parse_key_args "repair_timing" args \
     keys {-setup_margin -hold_margin -slack_margin \
             -libraries -max_utilization -max_buffer_percent \
-            -recover_power -repair_tns -max_passes} \
+            -recover_power -repair_tns -speculative_batch -max_passes} \
     flags {-setup -hold -allow_setup_violations -skip_pin_swap -skip_gate_cloning -verbose}
 
   set setup [info exists flags(-setup)]
@@ -568,6 +569,12 @@ proc repair_timing { args } {
     set repair_tns_end_percent [expr $repair_tns_end_percent / 100.0]
   }
 
+  set speculative_batch_size 0
+  if { [info exists keys(-speculative_batch)] } {
+    set speculative_batch_size $keys(-speculative_batch)
+    sta::check_positive_integer "-speculative_batch" $speculative_batch_size
+  }
+
   set recover_power_percent -1
   if { [info exists keys(-recover_power)] } {
     set recover_power_percent $keys(-recover_power)
@@ -592,12 +599,12 @@ proc repair_timing { args } {
     if { $setup } {
       rsz::repair_setup $setup_margin $repair_tns_end_percent $max_passes \
         $verbose \
-        $skip_pin_swap $skip_gate_cloning
+        $skip_pin_swap $skip_gate_cloning $speculative_batch_size
     }
     if { $hold } {
       rsz::repair_hold $setup_margin $hold_margin \
         $allow_setup_violations $max_buffer_percent $max_passes \
-        $verbose
+        $verbose $speculative_batch_size
     }
   }
 }
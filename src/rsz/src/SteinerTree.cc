@@ -65,6 +65,19 @@ SteinerPt SteinerTree::null_pt = -1;
 
 // Returns nullptr if net has less than 2 pins or any pin is not placed.
 SteinerTree* Resizer::makeSteinerTree(const Pin* drvr_pin)
+{
+  stt::SteinerNet stt_net;
+  SteinerTree* tree = initSteinerTree(drvr_pin, stt_net);
+  if (tree) {
+    const stt::Tree ftree = stt_builder_->makeSteinerTree(
+        stt_net.net, stt_net.x, stt_net.y, stt_net.drvr_index);
+    finishSteinerTree(tree, ftree);
+  }
+  return tree;
+}
+
+SteinerTree* Resizer::initSteinerTree(const Pin* drvr_pin,
+                                      stt::SteinerNet& stt_net)
 {
   Network* sdc_network = network_->sdcNetwork();
   Net* net = network_->isTopLevelPort(drvr_pin)
@@ -91,7 +104,11 @@ SteinerTree* Resizer::makeSteinerTree(const Pin* drvr_pin)
                   sdc_network->pathName(net),
                   pin_count);
   } else if (pin_count >= 2) {
-    vector<int> x, y;  // Two separate vectors of coordinates needed by flute.
+    // Two separate vectors of coordinates needed by flute.
+    vector<int>& x = stt_net.x;
+    vector<int>& y = stt_net.y;
+    x.clear();
+    y.clear();
     int drvr_idx = 0;  // The "driver_pin" or the root of the Steiner tree.
     for (int i = 0; i < pin_count; i++) {
       const PinLoc& pinloc = pinlocs[i];
@@ -117,11 +134,8 @@ SteinerTree* Resizer::makeSteinerTree(const Pin* drvr_pin)
       tree->locAddPin(pinloc.loc, pinloc.pin);
     }
     if (is_placed) {
-      stt::Tree ftree = stt_builder_->makeSteinerTree(
-          db_network_->staToDb(net), x, y, drvr_idx);
-
-      tree->setTree(ftree, db_network_);
-      tree->createSteinerPtToPinMap();
+      stt_net.net = db_network_->staToDb(net);
+      stt_net.drvr_index = drvr_idx;
       return tree;
     }
   }
@@ -129,6 +143,12 @@ SteinerTree* Resizer::makeSteinerTree(const Pin* drvr_pin)
   return nullptr;
 }
 
+void Resizer::finishSteinerTree(SteinerTree* tree, const stt::Tree& ftree)
+{
+  tree->setTree(ftree, db_network_);
+  tree->createSteinerPtToPinMap();
+}
+
 static void connectedPins(const Net* net,
                           Network* network,
                           dbNetwork* db_network,
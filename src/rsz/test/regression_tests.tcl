@@ -58,12 +58,14 @@ record_tests {
   repair_hold12
   repair_hold13
   repair_hold14
+  repair_hold15
   repair_setup1
   repair_setup2
   repair_setup3
   repair_setup4
   repair_setup5
   repair_setup6
+  repair_setup7
   repair_slew1
   repair_slew2
   repair_slew3
@@ -0,0 +1,26 @@
+# repair_timing -hold -speculative_batch
+source "helpers.tcl"
+read_liberty Nangate45/Nangate45_typ.lib
+read_lef Nangate45/Nangate45.lef
+read_def gcd_nangate45_placed.def
+create_clock [get_ports clk] -name core_clock -period 2
+
+source Nangate45/Nangate45.rc
+set_wire_rc -layer metal3
+estimate_parasitics -placement
+
+set hold_slack_before [worst_slack -min]
+set setup_slack_before [worst_slack -max]
+set cell_count_before [llength [get_cells *]]
+
+# The buffer count depends on how the endpoints fall into batches.
+suppress_message RSZ 32
+suppress_message RSZ 64
+repair_timing -hold -hold_margin .4 -speculative_batch 8
+
+puts "Hold buffers inserted: [expr [llength [get_cells *]] > $cell_count_before]"
+puts "Hold slack improved: [expr [worst_slack -min] > $hold_slack_before]"
+# Batches that hurt setup or driver slews are rolled back, so batching
+# must not introduce setup violations.
+set setup_slack_floor [expr min($setup_slack_before, 0)]
+puts "Setup slack degraded: [expr [worst_slack -max] < $setup_slack_floor]"
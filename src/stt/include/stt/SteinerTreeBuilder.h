@@ -75,6 +75,15 @@ struct Tree
   int branchCount() const { return branch.size(); }
 };
 
+// Pins of one net for SteinerTreeBuilder::makeSteinerTrees.
+struct SteinerNet
+{
+  odb::dbNet* net;  // used to look up the net alpha; may be nullptr
+  std::vector<int> x;
+  std::vector<int> y;
+  int drvr_index;
+};
+
 class SteinerTreeBuilder
 {
  public:
@@ -100,6 +109,11 @@ class SteinerTreeBuilder
                        const std::vector<int>& y,
                        const std::vector<int>& s,
                        int acc);
+  // Build the trees of many nets using up to num_threads threads.
+  // trees[i] is the same tree makeSteinerTree(net, x, y, drvr_index)
+  // returns for nets[i].
+  std::vector<Tree> makeSteinerTrees(const std::vector<SteinerNet>& nets,
+                                     int num_threads);
   bool checkTree(const Tree& tree) const;
   float getAlpha() const { return alpha_; }
   void setAlpha(float alpha);
@@ -110,6 +124,7 @@ class SteinerTreeBuilder
 
  private:
   int computeHPWL(odb::dbNet* net);
+  float netAlpha(odb::dbNet* net);
 
   const int flute_accuracy = 3;
   float alpha_;
@@ -57,7 +57,8 @@ using stt::Tree;
 #define FLUTE_D 9  // LUT is used for d <= FLUTE_D, FLUTE_D <= 9
 
 // User-Callable Functions
-// Delete LUT tables for exit so they are not leaked.
+// Delete LUT tables for exit so they are not leaked.  The next flute call
+// reads them again.  Must not run concurrently with flute calls.
 void deleteLUT();
 int flute_wl(int d,
              const std::vector<int>& x,
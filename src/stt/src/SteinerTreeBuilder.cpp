@@ -75,23 +75,29 @@ Tree SteinerTreeBuilder::makeSteinerTree(odb::dbNet* net,
                                          const std::vector<int>& y,
                                          const int drvr_index)
 {
-  float net_alpha = alpha_;
-  int min_fanout = min_fanout_alpha_.first;
-  int min_hpwl = min_hpwl_alpha_.first;
+  return makeSteinerTree(x, y, drvr_index, netAlpha(net));
+}
 
-  if (net_alpha_map_.find(net) != net_alpha_map_.end()) {
-    net_alpha = net_alpha_map_[net];
-  } else if (min_hpwl > 0) {
-    if (computeHPWL(net) >= min_hpwl) {
-      net_alpha = min_hpwl_alpha_.second;
-    }
-  } else if (min_fanout > 0) {
-    if (net->getTermCount() - 1 >= min_fanout) {
-      net_alpha = min_fanout_alpha_.second;
-    }
+std::vector<Tree> SteinerTreeBuilder::makeSteinerTrees(
+    const std::vector<SteinerNet>& nets,
+    const int num_threads)
+{
+  const int net_count = nets.size();
+  // The alpha lookup walks the db and the alpha maps, so do it up front.
+  std::vector<float> alphas(net_count);
+  for (int i = 0; i < net_count; i++) {
+    alphas[i] = nets[i].net ? netAlpha(nets[i].net) : alpha_;
   }
 
-  return makeSteinerTree(x, y, drvr_index, net_alpha);
+  // Tree construction only reads the flute LUTs, which ensureLUT publishes
+  // safely, so each net can be built independently.
+  std::vector<Tree> trees(net_count);
+#pragma omp parallel for num_threads(num_threads) schedule(dynamic, 64)
+  for (int i = 0; i < net_count; i++) {
+    const SteinerNet& net = nets[i];
+    trees[i] = makeSteinerTree(net.x, net.y, net.drvr_index, alphas[i]);
+  }
+  return trees;
 }
 
 Tree SteinerTreeBuilder::makeSteinerTree(const std::vector<int>& x,
@@ -227,6 +233,27 @@ void SteinerTreeBuilder::setMinHPWLAlpha(int min_hpwl, float alpha)
   min_hpwl_alpha_ = {min_hpwl, alpha};
 }
 
+float SteinerTreeBuilder::netAlpha(odb::dbNet* net)
+{
+  float net_alpha = alpha_;
+  int min_fanout = min_fanout_alpha_.first;
+  int min_hpwl = min_hpwl_alpha_.first;
+
+  if (net_alpha_map_.find(net) != net_alpha_map_.end()) {
+    net_alpha = net_alpha_map_[net];
+  } else if (min_hpwl > 0) {
+    if (computeHPWL(net) >= min_hpwl) {
+      net_alpha = min_hpwl_alpha_.second;
+    }
+  } else if (min_fanout > 0) {
+    if (net->getTermCount() - 1 >= min_fanout) {
+      net_alpha = min_fanout_alpha_.second;
+    }
+  }
+
+  return net_alpha;
+}
+
 int SteinerTreeBuilder::computeHPWL(odb::dbNet* net)
 {
   int min_x = std::numeric_limits<int>::max();
@@ -33,12 +33,14 @@
 #include "stt/flute.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cctype>
 #include <climits>
 #include <cmath>
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
+#include <mutex>
 #include <string>
 
 // Use flute LUT file reader.
@@ -215,7 +217,11 @@ static void checkLUT(LUT_TYPE LUT1,
 
 // LUTs are initialized to this order at startup.
 static constexpr int lut_initial_d = 8;
-static int lut_valid_d = 0;
+// Highest degree whose LUT rows are complete. Published with release
+// semantics after the rows are written so that threads which observe it
+// can read those rows without taking lut_mutex.
+static std::atomic<int> lut_valid_d{0};
+static std::mutex lut_mutex;
 
 extern std::string post9;
 extern std::string powv9;
@@ -231,6 +237,7 @@ static void readLUT()
 #elif LUT_SOURCE == LUT_VAR
   // Only init to d=8 on startup because d=9 is big and slow.
   initLUT(lut_initial_d, LUT, numsoln);
+  lut_valid_d = lut_initial_d;
 
 #elif LUT_SOURCE == LUT_VAR_CHECK
   readLUTfiles(LUT, numsoln);
@@ -240,6 +247,7 @@ static void readLUT()
   makeLUT(LUT_, numsoln_);
   initLUT(FLUTE_D, LUT_, numsoln_);
   checkLUT(LUT, numsoln, LUT_, numsoln_);
+  lut_valid_d = FLUTE_D;
 #endif
 }
 
@@ -255,7 +263,11 @@ static void makeLUT(LUT_TYPE& LUT, NUMSOLN_TYPE& numsoln)
 
 void deleteLUT()
 {
+  std::lock_guard<std::mutex> lock(lut_mutex);
   deleteLUT(LUT, numsoln);
+  LUT = nullptr;
+  numsoln = nullptr;
+  lut_valid_d.store(0, std::memory_order_release);
 }
 
 static void deleteLUT(LUT_TYPE& LUT, NUMSOLN_TYPE& numsoln)
@@ -373,16 +385,33 @@ static void initLUT(int to_d, LUT_TYPE LUT, NUMSOLN_TYPE numsoln)
       }
     }
   }
-  lut_valid_d = to_d;
 }
 
+// Safe to call from multiple threads. Rows that are already valid are
+// never rewritten; higher degree rows are built in a scratch table and
+// moved into place before lut_valid_d is raised.
 static void ensureLUT(int d)
 {
+  const int need_d = d <= FLUTE_D ? d : 1;
+  if (need_d <= lut_valid_d.load(std::memory_order_acquire)) {
+    return;
+  }
+  std::lock_guard<std::mutex> lock(lut_mutex);
   if (LUT == nullptr) {
     readLUT();
   }
-  if (d > lut_valid_d && d <= FLUTE_D) {
-    initLUT(FLUTE_D, LUT, numsoln);
+  const int valid_d = lut_valid_d.load(std::memory_order_relaxed);
+  if (need_d > valid_d) {
+    LUT_TYPE full_lut;
+    NUMSOLN_TYPE full_numsoln;
+    makeLUT(full_lut, full_numsoln);
+    initLUT(FLUTE_D, full_lut, full_numsoln);
+    for (int row = valid_d + 1; row <= FLUTE_D; row++) {
+      std::swap(LUT[row], full_lut[row]);
+      std::swap(numsoln[row], full_numsoln[row]);
+    }
+    deleteLUT(full_lut, full_numsoln);
+    lut_valid_d.store(FLUTE_D, std::memory_order_release);
   }
 }
 
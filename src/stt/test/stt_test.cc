@@ -0,0 +1,68 @@
+#include <random>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "stt/SteinerTreeBuilder.h"
+#include "stt/flute.h"
+#include "utl/Logger.h"
+
+namespace stt {
+namespace {
+
+// Random nets of degree 4 to 40, a third of them exactly FLUTE_D, so the
+// batch needs the full LUT from the start.
+std::vector<SteinerNet> makeNets(int count)
+{
+  std::mt19937 rand(42);
+  std::uniform_int_distribution<int> coord(0, 1000000);
+  std::uniform_int_distribution<int> degree(4, 40);
+  std::vector<SteinerNet> nets(count);
+  for (int i = 0; i < count; i++) {
+    SteinerNet& net = nets[i];
+    const int d = (i % 3 == 0) ? FLUTE_D : degree(rand);
+    net.net = nullptr;
+    net.drvr_index = 0;
+    for (int j = 0; j < d; j++) {
+      net.x.push_back(coord(rand));
+      net.y.push_back(coord(rand));
+    }
+  }
+  return nets;
+}
+
+void expectSameTree(const Tree& tree, const Tree& expected)
+{
+  ASSERT_EQ(tree.deg, expected.deg);
+  EXPECT_EQ(tree.length, expected.length);
+  ASSERT_EQ(tree.branchCount(), expected.branchCount());
+  for (int i = 0; i < tree.branchCount(); i++) {
+    EXPECT_EQ(tree.branch[i].x, expected.branch[i].x);
+    EXPECT_EQ(tree.branch[i].y, expected.branch[i].y);
+    EXPECT_EQ(tree.branch[i].n, expected.branch[i].n);
+  }
+}
+
+// The batch starts from a cold LUT, so its threads race to build it.
+TEST(SteinerTreeBuilderTest, BatchMatchesSerialFromColdLUT)
+{
+  utl::Logger logger;
+  SteinerTreeBuilder builder;
+  builder.init(nullptr, &logger);
+  // Flute only; primDijkstra does not use the LUT.
+  builder.setAlpha(0.0);
+
+  const std::vector<SteinerNet> nets = makeNets(3000);
+  for (int round = 0; round < 4; round++) {
+    flt::deleteLUT();
+    const std::vector<Tree> trees = builder.makeSteinerTrees(nets, 4);
+    ASSERT_EQ(trees.size(), nets.size());
+    for (size_t i = 0; i < nets.size(); i++) {
+      const SteinerNet& net = nets[i];
+      expectSameTree(trees[i],
+                     builder.makeSteinerTree(net.x, net.y, net.drvr_index));
+    }
+  }
+}
+
+}  // namespace
+}  // namespace stt